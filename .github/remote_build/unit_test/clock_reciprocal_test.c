@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include <stdio.h>
+#include "./clock/k_clock_reciprocal.h"
+
+/* The full 24-bit SysTick reload range */
+#define RELOAD_RANGE (0x1000000u)
+
+/* The number of the random samples above the reload range */
+#define RANDOM_SAMPLES (0x100000u)
+
+static const _u32_t g_clock_mhz[] = {1u, 2u, 3u, 4u, 7u, 8u, 12u, 16u, 24u, 25u, 32u, 48u, 50u, 64u, 72u, 80u, 84u, 96u,
+                                     100u, 120u, 128u, 144u, 150u, 168u, 180u, 200u, 216u, 240u, 255u, 256u, 400u, 480u, 550u, 1000u};
+
+static _u32_t g_seed = 0x12345678u;
+
+static _u32_t _random_next(void)
+{
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return g_seed;
+}
+
+static int _reciprocal_check(_u32_t mhz, _u32_t count)
+{
+    clock_reciprocal_t recip;
+    clock_reciprocal_init(&recip, mhz);
+
+    _u32_t expect = count / mhz;
+    _u32_t actual = clock_reciprocal_divide(&recip, count);
+    if (expect != actual) {
+        printf("FAIL: mhz %u count %u expect %u actual %u\n", mhz, count, expect, actual);
+        return 1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    for (_u32_t i = 0u; i < (sizeof(g_clock_mhz) / sizeof(g_clock_mhz[0])); i++) {
+        _u32_t mhz = g_clock_mhz[i];
+        clock_reciprocal_t recip;
+        clock_reciprocal_init(&recip, mhz);
+
+        for (_u32_t count = 0u; count < RELOAD_RANGE; count++) {
+            if ((count / mhz) != clock_reciprocal_divide(&recip, count)) {
+                failed += _reciprocal_check(mhz, count);
+                break;
+            }
+        }
+
+        for (_u32_t n = 0u; n < RANDOM_SAMPLES; n++) {
+            _u32_t count = _random_next() & 0x7FFFFFFFu;
+            if ((count / mhz) != clock_reciprocal_divide(&recip, count)) {
+                failed += _reciprocal_check(mhz, count);
+                break;
+            }
+        }
+
+        failed += _reciprocal_check(mhz, 0x7FFFFFFFu);
+    }
+
+    printf("clock reciprocal test: %s\n", (failed) ? "FAILED" : "PASSED");
+    return (failed) ? 1 : 0;
+}
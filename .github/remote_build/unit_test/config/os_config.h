@@ -0,0 +1,15 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#ifndef _OS_CONFIG_H_
+#define _OS_CONFIG_H_
+
+/**
+ * The host unit tests and benchmarks use the kernel default configuration in the k_config.h,
+ * each test target overrides the symbols it measures by the compile definitions.
+ **/
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#ifndef _SCHED_KERNEL_H_
+#define _SCHED_KERNEL_H_
+
+/**
+ * The host stand-in of the kernel scheduler header, it keeps the scheduler interfaces that a kernel object source uses
+ * and leaves the arch and port headers out, the unit test provides these interfaces.
+ **/
+#include "k_struct.h"
+#include "k_type.h"
+#include "static_init.h"
+
+/**
+ * Data structure for svc call function arguments, it's the same as the port one.
+ */
+typedef struct {
+    union {
+        _u32_t u32_val;
+
+        _u16_t u16_val;
+
+        _u8_t u8_val;
+
+        _b_t b_val;
+
+        void *pv_val;
+
+        const void *ptr_val;
+
+        const _char_t *pch_val;
+    };
+} arguments_t;
+
+_u32_t impl_kernel_irq_disable(void);
+void impl_kernel_irq_enable(_u32_t val);
+
+#define ENTER_CRITICAL_SECTION() _u32_t __val = impl_kernel_irq_disable()
+#define EXIT_CRITICAL_SECTION()  impl_kernel_irq_enable(__val)
+
+thread_context_t *kernel_thread_runContextGet(void);
+_i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, wait_queue_t *pToQueue, _u32_t timeout_ms,
+                              _b_t immediately);
+_i32p_t schedule_entry_trigger(struct schedule_task *pTask, pTask_callbackFunc_t callback, _u32_t result);
+void schedule_priority_set(struct schedule_task *pTask, _i16_t prior);
+void schedule_priority_recover(struct schedule_task *pTask);
+void schedule_lock_hold(struct schedule_task *pTask, struct lock_hold *pHold);
+void schedule_lock_release(struct schedule_task *pTask, struct lock_hold *pHold);
+_i32p_t kernel_schedule_result_take(void);
+_b_t kernel_isInThreadMode(void);
+_i32p_t kernel_privilege_invoke(const void *pCallFun, arguments_t *pArgs);
+
+#endif /* _SCHED_KERNEL_H_ */
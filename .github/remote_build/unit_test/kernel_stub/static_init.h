@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#ifndef _STATIC_INIT_H_
+#define _STATIC_INIT_H_
+
+/**
+ * The host stand-in of the static init header, the kernel object sections are the arrays that the unit test defines.
+ **/
+#include "type_def.h"
+#include "k_struct.h"
+#include "k_config.h"
+
+#define INIT_SECTION_OS_RWLOCK_LIST g_test_rwlock_section
+#define TEST_RWLOCK_SECTION_NUM     (2u)
+
+extern rwlock_context_t g_test_rwlock_section[TEST_RWLOCK_SECTION_NUM];
+
+#define INIT_SECTION_FIRST(i_section, o_begin)                                                                                             \
+    do {                                                                                                                                   \
+        o_begin = (_u32_t)(uintptr_t)&i_section[0];                                                                                        \
+    } while (0)
+
+#define INIT_SECTION_LAST(i_section, o_end)                                                                                                \
+    do {                                                                                                                                   \
+        o_end = (_u32_t)(uintptr_t)&i_section[DIMOF(i_section)];                                                                           \
+    } while (0)
+
+enum {
+    INIT_SLOT_THREAD,
+    INIT_SLOT_TIMER,
+    INIT_SLOT_SEMAPHORE,
+    INIT_SLOT_MUTEX,
+    INIT_SLOT_RWLOCK,
+    INIT_SLOT_EVENT,
+    INIT_SLOT_QUEUE,
+    INIT_SLOT_POOL,
+    INIT_SLOT_PUBLISH,
+    INIT_SLOT_SUBSCRIBE,
+    INIT_SLOT_NUM,
+};
+
+void *init_slot_alloc(_u8_t type);
+void init_slot_free(_u8_t type, void *pSlot);
+void init_name_register(_u8_t type, void *pObject);
+void init_name_unregister(_u8_t type, void *pObject);
+
+void rwlock_read_queue_refresh(wait_queue_t *pQueue);
+void rwlock_write_queue_refresh(wait_queue_t *pQueue);
+
+#endif
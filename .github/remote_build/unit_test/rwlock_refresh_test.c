@@ -0,0 +1,301 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include <stdio.h>
+#include "sched_kernel.h"
+#include "sched_timer.h"
+
+/* The rwlock section, the first one prefers the writers and the second one doesn't */
+rwlock_context_t g_test_rwlock_section[TEST_RWLOCK_SECTION_NUM] = {
+    [0] = {.head = {.cs = CS_INITED, .pName = "writer_prefer"},
+           .writerPrefer = true,
+           .r_QList = {.pRefreshFunc = rwlock_read_queue_refresh},
+           .w_QList = {.pRefreshFunc = rwlock_write_queue_refresh}},
+    [1] = {.head = {.cs = CS_INITED, .pName = "reader_prefer"},
+           .writerPrefer = false,
+           .r_QList = {.pRefreshFunc = rwlock_read_queue_refresh},
+           .w_QList = {.pRefreshFunc = rwlock_write_queue_refresh}},
+};
+
+/* The scheduler entry list, the triggered threads are moved here in the arrival order */
+static list_t g_entry_list = LIST_NULL;
+static _u32_t g_failed = 0u;
+
+#define TEST_CHECK(cond)                                                                                                                   \
+    do {                                                                                                                                   \
+        if (!(cond)) {                                                                                                                     \
+            printf("%s:%d check failed: %s\n", __FILE__, __LINE__, #cond);                                                                 \
+            g_failed++;                                                                                                                    \
+        }                                                                                                                                  \
+    } while (0)
+
+_u32_t impl_kernel_irq_disable(void)
+{
+    return 0u;
+}
+
+void impl_kernel_irq_enable(_u32_t val)
+{
+    (void)val;
+}
+
+void timeout_remove(struct expired_time *pExpire, _b_t immediately)
+{
+    (void)pExpire;
+    (void)immediately;
+}
+
+thread_context_t *kernel_thread_runContextGet(void)
+{
+    return NULL;
+}
+
+_i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, wait_queue_t *pToQueue, _u32_t timeout_ms,
+                              _b_t immediately)
+{
+    (void)pTask;
+    (void)pHoldCtx;
+    (void)pHoldData;
+    (void)pToQueue;
+    (void)timeout_ms;
+    (void)immediately;
+    return 0;
+}
+
+_i32p_t schedule_entry_trigger(struct schedule_task *pTask, pTask_callbackFunc_t callback, _u32_t result)
+{
+    pTask->exec.entry.result = (_i32p_t)result;
+    pTask->exec.entry.fun = callback;
+    linker_list_transaction_common(&pTask->linker, &g_entry_list, LIST_TAIL);
+    return 0;
+}
+
+void schedule_priority_set(struct schedule_task *pTask, _i16_t prior)
+{
+    pTask->prior = prior;
+}
+
+void schedule_priority_recover(struct schedule_task *pTask)
+{
+    _i16_t prior = pTask->basePrior;
+    list_node_t *pNode = NULL;
+    list_iterator_t it = ITERATION_NULL;
+    list_iterator_init(&it, &pTask->holdList);
+    while (list_iterator_next_condition(&it, &pNode)) {
+        struct lock_hold *pHold = (struct lock_hold *)CONTAINEROF(pNode, struct lock_hold, node);
+        for (_u8_t i = 0u; i < DIMOF(pHold->pQueue); i++) {
+            if (!pHold->pQueue[i]) {
+                continue;
+            }
+
+            struct schedule_task *pCurTask = NULL;
+            list_iterator_t q_it = ITERATION_NULL;
+            list_iterator_init(&q_it, &pHold->pQueue[i]->list);
+            while (list_iterator_next_condition(&q_it, (void *)&pCurTask)) {
+                if (pCurTask->prior < prior) {
+                    prior = pCurTask->prior;
+                }
+            }
+        }
+    }
+    pTask->prior = prior;
+}
+
+void schedule_lock_hold(struct schedule_task *pTask, struct lock_hold *pHold)
+{
+    list_node_push(&pTask->holdList, &pHold->node, LIST_HEAD);
+}
+
+void schedule_lock_release(struct schedule_task *pTask, struct lock_hold *pHold)
+{
+    list_node_delete(&pTask->holdList, &pHold->node);
+    schedule_priority_recover(pTask);
+}
+
+_i32p_t kernel_schedule_result_take(void)
+{
+    return 0;
+}
+
+_b_t kernel_isInThreadMode(void)
+{
+    return true;
+}
+
+_i32p_t kernel_privilege_invoke(const void *pCallFun, arguments_t *pArgs)
+{
+    (void)pCallFun;
+    (void)pArgs;
+    return 0;
+}
+
+void _impl_trace_postcode_set(_u32_t cmpt, _u32_t code)
+{
+    (void)cmpt;
+    (void)code;
+}
+
+_u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName)
+{
+    (void)type;
+    (void)pName;
+    return 0u;
+}
+
+void *init_slot_alloc(_u8_t type)
+{
+    (void)type;
+    return NULL;
+}
+
+void init_slot_free(_u8_t type, void *pSlot)
+{
+    (void)type;
+    (void)pSlot;
+}
+
+void init_name_register(_u8_t type, void *pObject)
+{
+    (void)type;
+    (void)pObject;
+}
+
+void init_name_unregister(_u8_t type, void *pObject)
+{
+    (void)type;
+    (void)pObject;
+}
+
+static void _test_task_init(struct schedule_task *pTask, _i16_t prior)
+{
+    k_memset(pTask, 0x0u, sizeof(struct schedule_task));
+    pTask->prior = prior;
+    pTask->basePrior = prior;
+}
+
+static void _test_task_block(struct schedule_task *pTask, wait_queue_t *pQueue)
+{
+    linker_list_transaction_common(&pTask->linker, &pQueue->list, LIST_TAIL);
+}
+
+/* The blocking thread leaves by the timeout, the scheduler takes it out of the queue and then refreshes the queue */
+static void _test_task_timeout(struct schedule_task *pTask, wait_queue_t *pQueue)
+{
+    schedule_entry_trigger(pTask, NULL, (_u32_t)PC_OS_WAIT_TIMEOUT);
+    pQueue->pRefreshFunc(pQueue);
+}
+
+/* The PendSV drains the entry list and runs the deferred callbacks */
+static _u32_t _test_entry_drain(void)
+{
+    _u32_t num = 0u;
+    struct schedule_task *pCurTask = NULL;
+    while ((pCurTask = (struct schedule_task *)list_head(&g_entry_list)) != NULL) {
+        list_node_delete(&g_entry_list, &pCurTask->linker.node);
+        pCurTask->linker.pList = NULL;
+        if (pCurTask->exec.entry.fun) {
+            pCurTask->exec.entry.fun(pCurTask);
+        }
+        num++;
+    }
+    return num;
+}
+
+static _b_t _test_reader_holds(rwlock_context_t *pCurRwlock, struct schedule_task *pTask)
+{
+    for (_u8_t i = 0u; i < RWLOCK_READER_NUMBER_SUPPORTED; i++) {
+        if ((pCurRwlock->reader[i].pTask == pTask) && (pCurRwlock->reader[i].count)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* The kernel keeps the object addresses in 32 bits, so the test threads are static as the rwlocks are */
+
+/* The readers queued behind a writer that times out take the read lock together with the holding reader */
+static void _test_writer_timeout_with_readers_queued(void)
+{
+    rwlock_context_t *pCurRwlock = &g_test_rwlock_section[0];
+    static struct schedule_task holder, writer, reader[2];
+
+    _test_task_init(&holder, 10);
+    _test_task_init(&writer, 5);
+    _test_task_init(&reader[0], 6);
+    _test_task_init(&reader[1], 7);
+
+    pCurRwlock->reader[0].pTask = &holder;
+    pCurRwlock->reader[0].count = 1u;
+    pCurRwlock->readers = 1u;
+    _test_task_block(&writer, &pCurRwlock->w_QList);
+    _test_task_block(&reader[0], &pCurRwlock->r_QList);
+    _test_task_block(&reader[1], &pCurRwlock->r_QList);
+
+    /* The readers keep waiting behind the blocking writer */
+    pCurRwlock->r_QList.pRefreshFunc(&pCurRwlock->r_QList);
+    TEST_CHECK(_test_entry_drain() == 0u);
+    TEST_CHECK(list_size(&pCurRwlock->r_QList.list) == 2u);
+
+    _test_task_timeout(&writer, &pCurRwlock->w_QList);
+    TEST_CHECK(writer.exec.entry.result == PC_OS_WAIT_TIMEOUT);
+    TEST_CHECK(_test_entry_drain() == 3u);
+    TEST_CHECK(list_head(&pCurRwlock->r_QList.list) == NULL);
+    TEST_CHECK(pCurRwlock->pWriteTask == NULL);
+    TEST_CHECK(pCurRwlock->readers == 3u);
+    TEST_CHECK(_test_reader_holds(pCurRwlock, &holder));
+    TEST_CHECK(_test_reader_holds(pCurRwlock, &reader[0]));
+    TEST_CHECK(_test_reader_holds(pCurRwlock, &reader[1]));
+    TEST_CHECK(reader[0].exec.entry.result == 0);
+    TEST_CHECK(reader[1].exec.entry.result == 0);
+
+    k_memset(pCurRwlock->reader, 0x0u, sizeof(pCurRwlock->reader));
+    pCurRwlock->readers = 0u;
+}
+
+/* The holding writer drops the priority that was inherited from a blocking thread that times out */
+static void _test_writer_recover_on_waiter_timeout(void)
+{
+    rwlock_context_t *pCurRwlock = &g_test_rwlock_section[1];
+    static struct schedule_task owner, reader, writer;
+
+    _test_task_init(&owner, 10);
+    _test_task_init(&reader, 8);
+    _test_task_init(&writer, 3);
+
+    pCurRwlock->pWriteTask = &owner;
+    pCurRwlock->hold.pQueue[0] = &pCurRwlock->r_QList;
+    pCurRwlock->hold.pQueue[1] = &pCurRwlock->w_QList;
+    schedule_lock_hold(&owner, &pCurRwlock->hold);
+
+    _test_task_block(&reader, &pCurRwlock->r_QList);
+    _test_task_block(&writer, &pCurRwlock->w_QList);
+    owner.prior = writer.prior;
+
+    _test_task_timeout(&writer, &pCurRwlock->w_QList);
+    TEST_CHECK(owner.prior == reader.prior);
+    TEST_CHECK(pCurRwlock->pWriteTask == &owner);
+
+    _test_task_timeout(&reader, &pCurRwlock->r_QList);
+    TEST_CHECK(owner.prior == owner.basePrior);
+    TEST_CHECK(_test_entry_drain() == 2u);
+
+    schedule_lock_release(&owner, &pCurRwlock->hold);
+    pCurRwlock->pWriteTask = NULL;
+}
+
+int main(void)
+{
+    _test_writer_timeout_with_readers_queued();
+    _test_writer_recover_on_waiter_timeout();
+
+    if (g_failed) {
+        printf("rwlock refresh test: %u checks failed\n", (unsigned)g_failed);
+        return 1;
+    }
+
+    printf("rwlock refresh test: passed\n");
+    return 0;
+}
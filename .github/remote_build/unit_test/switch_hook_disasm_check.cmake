@@ -0,0 +1,28 @@
+# Compare the disassembly of the switch hook probe objects.
+#   OBJDUMP   The objdump program.
+#   REF       The probe object without the hook dispatch.
+#   PROBE     The probe object with the hook dispatch.
+#   EXPECT    SAME when the dispatch mustn't add any instruction, otherwise DIFFER.
+
+foreach(object REF PROBE)
+    execute_process(COMMAND ${OBJDUMP} -d ${${object}}
+        OUTPUT_VARIABLE disasm
+        RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "objdump failed on ${${object}}")
+    endif()
+
+    # The file name line differs between the objects
+    string(REGEX REPLACE "[^\n]*file format[^\n]*\n" "" disasm "${disasm}")
+    set(${object}_DISASM "${disasm}")
+endforeach()
+
+if(EXPECT STREQUAL "SAME" AND NOT REF_DISASM STREQUAL PROBE_DISASM)
+    message(FATAL_ERROR "The hook dispatch adds the instructions:\n${PROBE_DISASM}")
+elseif(EXPECT STREQUAL "DIFFER" AND REF_DISASM STREQUAL PROBE_DISASM)
+    message(FATAL_ERROR "The hook dispatch isn't seen in the disassembly")
+endif()
+
+string(REGEX MATCHALL "\n +[0-9a-f]+:" instructions "${PROBE_DISASM}")
+list(LENGTH instructions number)
+message(STATUS "switch hook probe: ${number} instructions, expect ${EXPECT}")
@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "k_hook.h"
+
+/**
+ * The probe is the switch commit tail of the kernel_scheduler_inPendSV_c, it's compiled with and without the hook dispatch,
+ * and the disassembly of both objects are compared.
+ */
+struct switch_hook_probe {
+    struct switch_hook switch_hook;
+
+    _u32_t task;
+
+    _u32_t pendsv_ms;
+};
+
+struct switch_hook_probe g_switch_hook_probe;
+
+void switch_hook_probe_commit(_u32_t out, _u32_t in, _u32_t ms)
+{
+    UNUSED_MSG(out);
+#if (SWITCH_HOOK_PROBE_INVOKE)
+    KERNEL_SWITCH_HOOK_INVOKE(&g_switch_hook_probe.switch_hook, out, in);
+#endif
+    g_switch_hook_probe.task = in;
+    g_switch_hook_probe.pendsv_ms = ms;
+}
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include <stdio.h>
+#include "k_hook.h"
+
+#if (!defined(SWITCH_OUT_HOOK_STATIC)) && (!defined(SWITCH_IN_HOOK_STATIC)) && (!SWITCH_HOOK_DYNAMIC_ENABLED)
+#define TEST_VARIANT "none"
+#elif (SWITCH_HOOK_DYNAMIC_ENABLED)
+#define TEST_VARIANT "dynamic"
+#else
+#define TEST_VARIANT "static"
+#endif
+
+#define TEST_OUT_ID (0x1000u)
+#define TEST_IN_ID  (0x2000u)
+
+/* The hook calls are recorded in order, the switch-out tag is 0x10000 and the switch-in tag is 0x20000 */
+static _u32_t g_record[4];
+static _u32_t g_record_num = 0u;
+static _u32_t g_evaluated = 0u;
+
+static void _test_record(_u32_t val)
+{
+    if (g_record_num < (sizeof(g_record) / sizeof(g_record[0]))) {
+        g_record[g_record_num] = val;
+    }
+    g_record_num++;
+}
+
+#if (SWITCH_HOOK_DYNAMIC_ENABLED)
+static void _test_hook_out(_u32_t id)
+{
+    _test_record(0x10000u | id);
+}
+
+static void _test_hook_in(_u32_t id)
+{
+    _test_record(0x20000u | id);
+}
+#endif
+
+#if defined(SWITCH_OUT_HOOK_STATIC)
+void SWITCH_OUT_HOOK_STATIC(_u32_t id)
+{
+    _test_record(0x10000u | id);
+}
+#endif
+
+#if defined(SWITCH_IN_HOOK_STATIC)
+void SWITCH_IN_HOOK_STATIC(_u32_t id)
+{
+    _test_record(0x20000u | id);
+}
+#endif
+
+static _u32_t _test_id_get(_u32_t id)
+{
+    g_evaluated++;
+    return id;
+}
+
+int main(void)
+{
+    struct switch_hook hook = {0};
+    int failed = 0;
+
+#if (SWITCH_HOOK_DYNAMIC_ENABLED)
+    hook.pOutFunc = _test_hook_out;
+    hook.pInFunc = _test_hook_in;
+#endif
+    UNUSED_MSG(hook);
+
+    KERNEL_SWITCH_HOOK_INVOKE(&hook, _test_id_get(TEST_OUT_ID), _test_id_get(TEST_IN_ID));
+
+#if (SWITCH_HOOK_NONE)
+    UNUSED_MSG(_test_record);
+    UNUSED_MSG(_test_id_get);
+
+    /* The hook-free build doesn't evaluate the arguments */
+    if ((g_evaluated) || (g_record_num)) {
+        printf("FAIL: %s evaluated %u arguments and ran %u hooks\n", TEST_VARIANT, g_evaluated, g_record_num);
+        failed = 1;
+    }
+#else
+    /* Each switch runs the switch-out hook before the switch-in hook */
+    if ((g_record_num != 2u) || (g_record[0] != (0x10000u | TEST_OUT_ID)) || (g_record[1] != (0x20000u | TEST_IN_ID))) {
+        printf("FAIL: %s ran %u hooks\n", TEST_VARIANT, g_record_num);
+        failed = 1;
+    }
+#endif
+
+    return failed;
+}
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include <stdio.h>
+#include "k_type.h"
+
+typedef struct {
+    _u64_t us;
+    _u32_t expect;
+} time_us_case_t;
+
+static const time_us_case_t g_time_us_cases[] = {
+    {0u, 0x80000000u},
+    {1u, 0x80000001u},
+    {1000000u, 0x800F4240u},
+    {0x7FFFFFFCu, 0xFFFFFFFCu},
+    {0x7FFFFFFDu, 0xFFFFFFFDu},
+    /* The values above the maximum are clamped, they never become the OS_TIME_FOREVER_VAL or OS_TIME_INVALID_VAL */
+    {0x7FFFFFFEu, 0xFFFFFFFDu},
+    {0x7FFFFFFFu, 0xFFFFFFFDu},
+    {0x80000000u, 0xFFFFFFFDu},
+    {0xFFFFFFFFu, 0xFFFFFFFDu},
+    /* The 64-bit value is clamped before it's truncated */
+    {0x100000005ull, 0xFFFFFFFDu},
+};
+
+int main(void)
+{
+    int failed = 0;
+
+    for (_u32_t i = 0u; i < (sizeof(g_time_us_cases) / sizeof(g_time_us_cases[0])); i++) {
+        const time_us_case_t *pCase = &g_time_us_cases[i];
+        _u32_t timeout = OS_TIME_US_ENCODE(pCase->us);
+
+        if ((timeout != pCase->expect) || (timeout == OS_TIME_FOREVER_VAL) || (timeout == OS_TIME_INVALID_VAL)) {
+            printf("FAIL: us %llu encodes 0x%08X expect 0x%08X\n", (unsigned long long)pCase->us, timeout, pCase->expect);
+            failed = 1;
+        }
+    }
+
+    /* The negative value is clamped as well */
+    if (OS_TIME_US_ENCODE(-1) != (OS_TIME_US_FLAG_VAL | OS_TIME_US_MAX_VAL)) {
+        printf("FAIL: negative us isn't clamped\n");
+        failed = 1;
+    }
+
+    return failed;
+}
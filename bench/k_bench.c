@@ -0,0 +1,583 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "k_bench.h"
+#include "k_hook.h"
+
+/* Local defined the bench error postcode */
+#define _PCER PC_IER(PC_OS_CMPT_KERNEL_2)
+
+/**
+ * The timestamp source is the core cycle counter, the core without it falls back to the kernel microsecond time.
+ */
+#include "./arch/k_arch.h"
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+#define BENCH_UNIT "cycles"
+#else
+#define BENCH_UNIT "us"
+#endif
+
+/**
+ * The switch cases run through the kernel_scheduler_inPendSV_c, so the builds with and without the switch hooks are compared by it.
+ */
+#if (SWITCH_HOOK_NONE)
+#define BENCH_HOOK "none"
+#elif (SWITCH_HOOK_DYNAMIC_ENABLED)
+#define BENCH_HOOK "dynamic"
+#else
+#define BENCH_HOOK "static"
+#endif
+
+#define BENCH_LINE_SIZE      (224u)
+#define BENCH_EVENT_BIT      (0x01u)
+#define BENCH_MSGQ_NUMBER    (4u)
+#define BENCH_MSGQ_SIZE_MAX  (64u)
+#define BENCH_POOL_NUMBER    (4u)
+#define BENCH_POOL_SIZE      (32u)
+#define BENCH_TIMER_IDLE_MS  (60000u)
+#define BENCH_TIMER_PROBE_MS (1000u)
+
+/**
+ * The commands of the helper thread, each of them runs BENCH_SAMPLE_NUMBER rounds against the driver thread.
+ */
+enum {
+    BENCH_CMD_SWITCH = 0u,
+    BENCH_CMD_PINGPONG,
+    BENCH_CMD_MUTEX,
+    BENCH_CMD_EVENT,
+    BENCH_CMD_STOP,
+};
+
+/**
+ * Data structure for the bench resource
+ */
+typedef struct {
+    pBench_outputFunc_t pOutputFunc;
+
+    os_sem_id_t cmd_sem;
+
+    os_sem_id_t ping_sem;
+
+    os_sem_id_t pong_sem;
+
+    os_mutex_id_t mutex;
+
+    os_evt_id_t evt;
+
+    volatile u8_t cmd;
+
+    /* The timestamp recorded by the helper thread when it's woken up */
+    volatile u32_t stamp;
+
+    u32_t samples[BENCH_SAMPLE_NUMBER];
+
+    u8_t msgq_buffer[BENCH_MSGQ_NUMBER * BENCH_MSGQ_SIZE_MAX];
+
+    u8_t pool_buffer[BENCH_POOL_NUMBER * BENCH_POOL_SIZE];
+
+    u32_t sub_data[BENCH_SUBSCRIBE_NUMBER];
+
+    os_timer_id_t timer[BENCH_TIMER_NUMBER + 1u];
+} _bench_resource_t;
+
+/**
+ * Local bench resource
+ */
+static _bench_resource_t g_bench_rsc;
+
+OS_STACK_INIT(g_bench_driver_stack, BENCH_THREAD_STACK_SIZE);
+OS_STACK_INIT(g_bench_helper_stack, BENCH_THREAD_STACK_SIZE);
+
+/**
+ * @brief Enable the timestamp source.
+ */
+static void _bench_stamp_init(void)
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+ * @brief Get the current timestamp, the difference of two timestamps is taken in 32 bits.
+ *
+ * @return The current timestamp in BENCH_UNIT.
+ */
+static u32_t _bench_stamp(void)
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    return DWT->CYCCNT;
+#else
+    return (u32_t)os_timer_system_total_us();
+#endif
+}
+
+static char_t *_bench_str_append(char_t *pDst, const char_t *pSrc)
+{
+    while (*pSrc) {
+        *pDst++ = *pSrc++;
+    }
+    *pDst = '\0';
+    return pDst;
+}
+
+static char_t *_bench_u32_append(char_t *pDst, u32_t val)
+{
+    char_t digits[10];
+    u8_t num = 0u;
+
+    do {
+        digits[num++] = (char_t)('0' + (val % 10u));
+        val /= 10u;
+    } while (val);
+
+    while (num) {
+        *pDst++ = digits[--num];
+    }
+    *pDst = '\0';
+    return pDst;
+}
+
+/**
+ * @brief Output the case result as one JSON line.
+ *
+ * @param pCase The case name.
+ * @param param The case parameter, it's the element size, the subscriber number or the active timer number.
+ * @param pError The error reason, the NULL indicates the samples are reported.
+ */
+static void _bench_output(const char_t *pCase, u32_t param, const char_t *pError)
+{
+    char_t line[BENCH_LINE_SIZE];
+    char_t *pLine = line;
+
+    pLine = _bench_str_append(pLine, "{\"bench\":\"atos\",\"case\":\"");
+    pLine = _bench_str_append(pLine, pCase);
+    pLine = _bench_str_append(pLine, "\",\"param\":");
+    pLine = _bench_u32_append(pLine, param);
+
+    if (pError) {
+        pLine = _bench_str_append(pLine, ",\"error\":\"");
+        pLine = _bench_str_append(pLine, pError);
+        pLine = _bench_str_append(pLine, "\"}");
+        g_bench_rsc.pOutputFunc(line);
+        return;
+    }
+
+    /* The insertion sort is good enough for the small sample number, and it doesn't need the libc */
+    u32_t *pSamples = g_bench_rsc.samples;
+    for (u32_t i = 1u; i < BENCH_SAMPLE_NUMBER; i++) {
+        u32_t val = pSamples[i];
+        u32_t j = i;
+        while ((j) && (pSamples[j - 1u] > val)) {
+            pSamples[j] = pSamples[j - 1u];
+            j--;
+        }
+        pSamples[j] = val;
+    }
+
+    pLine = _bench_str_append(pLine, ",\"hook\":\"" BENCH_HOOK "\",\"unit\":\"" BENCH_UNIT "\",\"n\":");
+    pLine = _bench_u32_append(pLine, BENCH_SAMPLE_NUMBER);
+    pLine = _bench_str_append(pLine, ",\"min\":");
+    pLine = _bench_u32_append(pLine, pSamples[0]);
+    pLine = _bench_str_append(pLine, ",\"p50\":");
+    pLine = _bench_u32_append(pLine, pSamples[BENCH_SAMPLE_NUMBER / 2u]);
+    pLine = _bench_str_append(pLine, ",\"p99\":");
+    pLine = _bench_u32_append(pLine, pSamples[(BENCH_SAMPLE_NUMBER * 99u) / 100u]);
+    pLine = _bench_str_append(pLine, ",\"max\":");
+    pLine = _bench_u32_append(pLine, pSamples[BENCH_SAMPLE_NUMBER - 1u]);
+    pLine = _bench_str_append(pLine, "}");
+    g_bench_rsc.pOutputFunc(line);
+}
+
+/**
+ * @brief Start a helper thread command, the higher priority helper thread runs until it's blocked on the command.
+ *
+ * @param cmd The helper thread command.
+ */
+static void _bench_command(u8_t cmd)
+{
+    g_bench_rsc.cmd = cmd;
+    os_sem_give(g_bench_rsc.cmd_sem);
+}
+
+/**
+ * @brief The helper thread is woken up by the driver thread in each sample round.
+ *
+ * @param pArg The thread argument.
+ */
+static void _bench_helper_thread(void *pArg)
+{
+    os_evt_val_t evt_val = {0u};
+
+    UNUSED_MSG(pArg);
+
+    while (1) {
+        os_sem_take(g_bench_rsc.cmd_sem, OS_TIME_WAIT_FOREVER);
+
+        u8_t cmd = g_bench_rsc.cmd;
+        if (cmd == BENCH_CMD_STOP) {
+            return;
+        }
+
+        for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+            switch (cmd) {
+            case BENCH_CMD_SWITCH:
+                os_sem_take(g_bench_rsc.ping_sem, OS_TIME_WAIT_FOREVER);
+                g_bench_rsc.stamp = _bench_stamp();
+                break;
+
+            case BENCH_CMD_PINGPONG:
+                os_sem_take(g_bench_rsc.ping_sem, OS_TIME_WAIT_FOREVER);
+                os_sem_give(g_bench_rsc.pong_sem);
+                break;
+
+            case BENCH_CMD_MUTEX:
+                os_sem_take(g_bench_rsc.ping_sem, OS_TIME_WAIT_FOREVER);
+                os_mutex_lock(g_bench_rsc.mutex);
+                g_bench_rsc.stamp = _bench_stamp();
+                os_mutex_unlock(g_bench_rsc.mutex);
+                break;
+
+            case BENCH_CMD_EVENT:
+                os_evt_wait(g_bench_rsc.evt, &evt_val, BENCH_EVENT_BIT, OS_TIME_WAIT_FOREVER);
+                g_bench_rsc.stamp = _bench_stamp();
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief The context switch latency, it's from the semaphore give to the first instruction of the woken thread.
+ */
+static void _bench_switch_run(void)
+{
+    _bench_command(BENCH_CMD_SWITCH);
+
+    for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+        u32_t start = _bench_stamp();
+        os_sem_give(g_bench_rsc.ping_sem);
+        g_bench_rsc.samples[i] = g_bench_rsc.stamp - start;
+    }
+    _bench_output("switch", 0u, NULL);
+}
+
+/**
+ * @brief The semaphore ping-pong round trip between the driver and helper thread.
+ */
+static void _bench_sem_pingpong_run(void)
+{
+    _bench_command(BENCH_CMD_PINGPONG);
+
+    for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+        u32_t start = _bench_stamp();
+        os_sem_give(g_bench_rsc.ping_sem);
+        os_sem_take(g_bench_rsc.pong_sem, OS_TIME_WAIT_FOREVER);
+        g_bench_rsc.samples[i] = _bench_stamp() - start;
+    }
+    _bench_output("sem_pingpong", 0u, NULL);
+}
+
+/**
+ * @brief The uncontended mutex lock/unlock pair, and the contended unlock handoff to the blocking helper thread.
+ */
+static void _bench_mutex_run(void)
+{
+    g_bench_rsc.mutex = os_mutex_init(NULL);
+    if (os_id_is_invalid(g_bench_rsc.mutex)) {
+        _bench_output("mutex_uncontended", 0u, "init");
+        return;
+    }
+
+    for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+        u32_t start = _bench_stamp();
+        os_mutex_lock(g_bench_rsc.mutex);
+        os_mutex_unlock(g_bench_rsc.mutex);
+        g_bench_rsc.samples[i] = _bench_stamp() - start;
+    }
+    _bench_output("mutex_uncontended", 0u, NULL);
+
+    _bench_command(BENCH_CMD_MUTEX);
+
+    for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+        os_mutex_lock(g_bench_rsc.mutex);
+        /* The helper thread is blocked on the mutex that the driver thread is holding */
+        os_sem_give(g_bench_rsc.ping_sem);
+
+        u32_t start = _bench_stamp();
+        os_mutex_unlock(g_bench_rsc.mutex);
+        g_bench_rsc.samples[i] = g_bench_rsc.stamp - start;
+    }
+    _bench_output("mutex_contended", 0u, NULL);
+
+    os_mutex_delete(g_bench_rsc.mutex);
+}
+
+/**
+ * @brief The message queue put/get pair by the element size.
+ */
+static void _bench_msgq_run(void)
+{
+    static const u16_t sizes[] = {4u, 16u, BENCH_MSGQ_SIZE_MAX};
+    u8_t msg[BENCH_MSGQ_SIZE_MAX] = {0u};
+
+    for (u32_t s = 0u; s < DIMOF(sizes); s++) {
+        u16_t size = sizes[s];
+        os_msgq_id_t msgq = os_msgq_init(g_bench_rsc.msgq_buffer, size, BENCH_MSGQ_NUMBER, NULL);
+        if (os_id_is_invalid(msgq)) {
+            _bench_output("msgq_put_get", size, "init");
+            return;
+        }
+
+        for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+            u32_t start = _bench_stamp();
+            i32p_t put = os_msgq_put(msgq, msg, size, false, OS_TIME_NOWAIT);
+            i32p_t get = os_msgq_get(msgq, msg, size, false, OS_TIME_NOWAIT);
+            g_bench_rsc.samples[i] = _bench_stamp() - start;
+
+            if ((put != OS_PC_OK) || (get != OS_PC_OK)) {
+                _bench_output("msgq_put_get", size, (put != OS_PC_OK) ? "put" : "get");
+                os_msgq_delete(msgq);
+                return;
+            }
+        }
+        _bench_output("msgq_put_get", size, NULL);
+
+        os_msgq_delete(msgq);
+    }
+}
+
+/**
+ * @brief The memory pool take/release pair.
+ */
+static void _bench_pool_run(void)
+{
+    os_pool_id_t pool = os_pool_init(g_bench_rsc.pool_buffer, BENCH_POOL_SIZE, BENCH_POOL_NUMBER, NULL);
+    if (os_id_is_invalid(pool)) {
+        _bench_output("pool_take_release", BENCH_POOL_SIZE, "init");
+        return;
+    }
+
+    for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+        void *pMem = NULL;
+        u32_t start = _bench_stamp();
+        i32p_t take = os_pool_take(pool, &pMem, BENCH_POOL_SIZE, OS_TIME_NOWAIT);
+        i32p_t release = os_pool_release(pool, &pMem);
+        g_bench_rsc.samples[i] = _bench_stamp() - start;
+
+        if ((take != OS_PC_OK) || (release != OS_PC_OK)) {
+            _bench_output("pool_take_release", BENCH_POOL_SIZE, (take != OS_PC_OK) ? "take" : "release");
+            os_pool_delete(pool);
+            return;
+        }
+    }
+    _bench_output("pool_take_release", BENCH_POOL_SIZE, NULL);
+
+    os_pool_delete(pool);
+}
+
+/**
+ * @brief The event set latency, it's from the set operation to the first instruction of the waiting thread.
+ */
+static void _bench_event_run(void)
+{
+    /* Any change of the bit triggers, so the driver thread toggles it in each round */
+    g_bench_rsc.evt = os_evt_init(BENCH_EVENT_BIT, 0u, 0u, 0u, NULL);
+    if (os_id_is_invalid(g_bench_rsc.evt)) {
+        _bench_output("evt_set_wait", 0u, "init");
+        return;
+    }
+
+    _bench_command(BENCH_CMD_EVENT);
+
+    for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+        u32_t start = _bench_stamp();
+        os_evt_set(g_bench_rsc.evt, 0u, 0u, BENCH_EVENT_BIT);
+        g_bench_rsc.samples[i] = g_bench_rsc.stamp - start;
+    }
+    _bench_output("evt_set_wait", 0u, NULL);
+
+    os_evt_delete(g_bench_rsc.evt);
+}
+
+static void _bench_subscribe_notify(const void *pData, u16_t len)
+{
+    UNUSED_MSG(pData);
+    UNUSED_MSG(len);
+}
+
+/**
+ * @brief The publish data submit by the subscriber number, it's reported at each power of two subscribers.
+ */
+static void _bench_publish_run(void)
+{
+    u32_t data = 0u;
+    os_publish_id_t publish = os_publish_init(NULL);
+    if (os_id_is_invalid(publish)) {
+        _bench_output("publish_fanout", 0u, "init");
+        return;
+    }
+
+    for (u32_t num = 1u; num <= BENCH_SUBSCRIBE_NUMBER; num++) {
+        os_subscribe_id_t subscribe = os_subscribe_init(&g_bench_rsc.sub_data[num - 1u], sizeof(u32_t), NULL);
+        if (os_id_is_invalid(subscribe)) {
+            _bench_output("publish_fanout", num, "init");
+            return;
+        }
+        os_subscribe_register(subscribe, publish, false, _bench_subscribe_notify);
+
+        if (num & (num - 1u)) {
+            continue;
+        }
+
+        for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+            data++;
+            u32_t start = _bench_stamp();
+            os_publish_data_submit(publish, &data, sizeof(u32_t));
+            g_bench_rsc.samples[i] = _bench_stamp() - start;
+        }
+        _bench_output("publish_fanout", num, NULL);
+    }
+}
+
+static void _bench_timer_callback(void *pArg)
+{
+    UNUSED_MSG(pArg);
+}
+
+/**
+ * @brief The timer arm/cancel pair by the active timer number, it's reported at zero and each power of two timers.
+ */
+static void _bench_timer_run(void)
+{
+    os_timer_id_t *pTimer = g_bench_rsc.timer;
+    u32_t created = 0u;
+
+    for (; created <= BENCH_TIMER_NUMBER; created++) {
+        pTimer[created] = os_timer_init(_bench_timer_callback, NULL, NULL);
+        if (os_id_is_invalid(pTimer[created])) {
+            _bench_output("timer_arm_cancel", created, "init");
+            break;
+        }
+    }
+
+    /* The last timer is the probe, and the others are kept active with a long timeout */
+    for (u32_t active = 0u; (created > BENCH_TIMER_NUMBER) && (active <= BENCH_TIMER_NUMBER); active++) {
+        if (active) {
+            os_timer_start(pTimer[active - 1u], OS_TIMER_CTRL_ONCE, BENCH_TIMER_IDLE_MS);
+        }
+
+        if ((active) && (active & (active - 1u))) {
+            continue;
+        }
+
+        for (u32_t i = 0u; i < BENCH_SAMPLE_NUMBER; i++) {
+            u32_t start = _bench_stamp();
+            os_timer_start(pTimer[BENCH_TIMER_NUMBER], OS_TIMER_CTRL_ONCE, BENCH_TIMER_PROBE_MS);
+            os_timer_stop(pTimer[BENCH_TIMER_NUMBER]);
+            g_bench_rsc.samples[i] = _bench_stamp() - start;
+        }
+        _bench_output("timer_arm_cancel", active, NULL);
+    }
+
+    while (created) {
+        created--;
+        os_timer_stop(pTimer[created]);
+        os_timer_delete(pTimer[created]);
+    }
+}
+
+/**
+ * @brief Delete the bench semaphores that were created, the helper thread mustn't block on them any more.
+ */
+static void _bench_sem_release(void)
+{
+    os_sem_id_t *pSem[] = {&g_bench_rsc.cmd_sem, &g_bench_rsc.ping_sem, &g_bench_rsc.pong_sem};
+
+    for (u8_t i = 0u; i < (sizeof(pSem) / sizeof(pSem[0])); i++) {
+        if (!os_id_is_invalid(*pSem[i])) {
+            os_sem_delete(*pSem[i]);
+        }
+    }
+}
+
+/**
+ * @brief The driver thread runs all the bench cases one by one, and outputs the done line at last.
+ *
+ * @param pArg The thread argument.
+ */
+static void _bench_driver_thread(void *pArg)
+{
+    UNUSED_MSG(pArg);
+
+    _bench_stamp_init();
+
+    _bench_switch_run();
+    _bench_sem_pingpong_run();
+    _bench_mutex_run();
+    _bench_msgq_run();
+    _bench_pool_run();
+    _bench_event_run();
+    _bench_publish_run();
+    _bench_timer_run();
+
+    /* The higher priority helper thread has taken the stop command and exited when it returns */
+    _bench_command(BENCH_CMD_STOP);
+    _bench_sem_release();
+    g_bench_rsc.pOutputFunc("{\"bench\":\"atos\",\"case\":\"done\",\"unit\":\"" BENCH_UNIT "\"}");
+}
+
+/**
+ * @brief Start the kernel microbenchmark, it runs in the bench threads and outputs the results by the JSON lines.
+ *
+ * The results are in the BENCH_UNIT with the min/p50/p99/max of BENCH_SAMPLE_NUMBER samples, it's one line per case.
+ * It needs 3 semaphores, 1 mutex, 1 event, 1 queue, 1 pool, 1 publish, BENCH_SUBSCRIBE_NUMBER subscribes,
+ * BENCH_TIMER_NUMBER + 1 timers and 2 threads at the runtime.
+ *
+ * @param pOutputFunc The output function of the result lines.
+ *
+ * @return The result of the operation.
+ */
+i32p_t atos_bench_start(pBench_outputFunc_t pOutputFunc)
+{
+    if (!pOutputFunc) {
+        return _PCER;
+    }
+
+    g_bench_rsc.pOutputFunc = pOutputFunc;
+    g_bench_rsc.cmd_sem = os_sem_init(0u, OS_SEM_LIMIT_BINARY, NULL);
+    g_bench_rsc.ping_sem = os_sem_init(0u, OS_SEM_LIMIT_BINARY, NULL);
+    g_bench_rsc.pong_sem = os_sem_init(0u, OS_SEM_LIMIT_BINARY, NULL);
+    if (os_id_is_invalid(g_bench_rsc.cmd_sem) || os_id_is_invalid(g_bench_rsc.ping_sem) || os_id_is_invalid(g_bench_rsc.pong_sem)) {
+        _bench_output("start", 0u, "init");
+        _bench_sem_release();
+        return _PCER;
+    }
+
+    os_thread_id_t helper = os_thread_init(g_bench_helper_stack, BENCH_THREAD_STACK_SIZE, BENCH_THREAD_PRIORITY - 1,
+                                           _bench_helper_thread, NULL, "bench_helper");
+    os_thread_id_t driver =
+        os_thread_init(g_bench_driver_stack, BENCH_THREAD_STACK_SIZE, BENCH_THREAD_PRIORITY, _bench_driver_thread, NULL, "bench_driver");
+    if (os_id_is_invalid(helper) || os_id_is_invalid(driver)) {
+        _bench_output("start", 0u, "init");
+        /* The created thread is deleted first, it blocks on the command semaphore */
+        if (!os_id_is_invalid(helper)) {
+            os_thread_delete(helper);
+        }
+        if (!os_id_is_invalid(driver)) {
+            os_thread_delete(driver);
+        }
+        _bench_sem_release();
+        return _PCER;
+    }
+    return OS_PC_OK;
+}
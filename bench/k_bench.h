@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#ifndef _K_BENCH_H_
+#define _K_BENCH_H_
+
+#include "at_rtos.h"
+
+/* The number of the timing samples of each case */
+#ifndef BENCH_SAMPLE_NUMBER
+#define BENCH_SAMPLE_NUMBER (128u)
+#endif
+
+/* The priority of the bench driver thread, the helper thread runs one level higher */
+#ifndef BENCH_THREAD_PRIORITY
+#define BENCH_THREAD_PRIORITY (OS_PRIORITY_APPLICATION_LOWEST_LEVEL - 1)
+#endif
+
+#ifndef BENCH_THREAD_STACK_SIZE
+#define BENCH_THREAD_STACK_SIZE (1024u)
+#endif
+
+/* The maximum subscriber number of the publish fan-out case */
+#ifndef BENCH_SUBSCRIBE_NUMBER
+#define BENCH_SUBSCRIBE_NUMBER (8u)
+#endif
+
+/* The maximum active timer number of the timer arm/cancel case */
+#ifndef BENCH_TIMER_NUMBER
+#define BENCH_TIMER_NUMBER (8u)
+#endif
+
+/**
+ * The bench output function receives one JSON line of each case result, or the final done line.
+ */
+typedef void (*pBench_outputFunc_t)(const char_t *pLine);
+
+i32p_t atos_bench_start(pBench_outputFunc_t pOutputFunc);
+
+#endif /* _K_BENCH_H_ */
@@ -41,6 +41,9 @@ typedef _i32p_t i32p_t;
 
 #define OS_TIME_NOWAIT       (OS_TIME_NOWAIT_VAL)
 #define OS_TIME_WAIT_FOREVER (OS_TIME_FOREVER_VAL)
+/* The microsecond timeout (up to 0x7FFFFFFD us, the larger one is clamped) for all timed waits */
+/* The millisecond value must be less than 0x80000000 */
+#define OS_TIME_US(us)       (OS_TIME_US_ENCODE(us))
 typedef u32_t os_timeout_t;
 
 typedef enum {
@@ -49,6 +52,32 @@ typedef enum {
     OS_TIMER_CTRL_TEMPORARY = (TIMER_CTRL_TEMPORARY_VAL),
 } os_timer_ctrl_t;
 
+typedef enum {
+    OS_TIMER_CATCHUP_SKIP = (TIMER_CATCHUP_SKIP_VAL),
+    OS_TIMER_CATCHUP_BURST = (TIMER_CATCHUP_BURST_VAL),
+    OS_TIMER_CATCHUP_COALESCE = (TIMER_CATCHUP_COALESCE_VAL),
+} os_timer_catchup_t;
+
+/**
+ * The hard timer callback runs in the clock interrupt directly with the lowest jitter, it must follow the rules:
+ * - It runs in the critical section, keep it as short as possible.
+ * - It must not call any blocking interface, only the OS_TIME_NOWAIT or non-blocking interface is allowed.
+ * - It must not call the thread sleep, yield, suspend, or delete interface.
+ * - The callback data is shared with the interrupt, it needs the interrupt-safe access in the thread.
+ **/
+#define OS_TIMER_SERVICE_KERNEL (TIMER_SERVICE_KERNEL_VAL)
+#define OS_TIMER_SERVICE_HARD   (TIMER_SERVICE_HARD_VAL)
+
+typedef enum {
+    OS_WAIT_ORDER_PRIORITY = (WAIT_ORDER_PRIORITY_VAL),
+    OS_WAIT_ORDER_FIFO = (WAIT_ORDER_FIFO_VAL),
+} os_wait_order_t;
+
+typedef enum {
+    OS_EVT_WAIT_ANY = (EVENT_WAIT_ANY_VAL),
+    OS_EVT_WAIT_ALL = (EVENT_WAIT_ALL_VAL),
+} os_evt_wait_opt_t;
+
 #if (OS_ID_ENHANCEMENT_ENABLED)
 #define OS_ID_NODATA (0)
 #else
@@ -60,6 +89,7 @@ typedef void *os_thread_id_t;
 typedef void *os_timer_id_t;
 typedef void *os_sem_id_t;
 typedef void *os_mutex_id_t;
+typedef void *os_rwlock_id_t;
 typedef void *os_evt_id_t;
 typedef void *os_msgq_id_t;
 typedef void *os_pool_id_t;
@@ -70,6 +100,7 @@ typedef struct os_id os_thread_id_t;
 typedef struct os_id os_timer_id_t;
 typedef struct os_id os_sem_id_t;
 typedef struct os_id os_mutex_id_t;
+typedef struct os_id os_rwlock_id_t;
 typedef struct os_id os_evt_id_t;
 typedef struct os_id os_msgq_id_t;
 typedef struct os_id os_pool_id_t;
@@ -78,6 +109,11 @@ typedef struct os_id os_subscribe_id_t;
 #endif
 
 typedef struct evt_val os_evt_val_t;
+typedef struct timer_lateness os_timer_lateness_t;
+typedef struct idle_state os_idle_state_t;
+typedef struct idle_residency os_idle_residency_t;
+typedef struct kernel_transaction os_transaction_t;
+typedef struct stackless_task os_stackless_t;
 
 #define OS_ID_SET(p_handle, u32_value) p_handle->u32_val = (u32_value)
 
@@ -88,11 +124,45 @@ typedef struct evt_val os_evt_val_t;
 #define OS_PRIORITY_PREEMPT_SET(p)     (p)
 #define OS_PRIORITY_COOPERATION_SET(c) (-(OS_PRIOTITY_COOPERATION_NUM - (c)))
 
+/**
+ * The stackless task body is a resumable function, it's written between the OS_STACKLESS_BEGIN and OS_STACKLESS_END.
+ * The local variables are not kept when the task is suspended, the persistent state has to be kept in the argument.
+ * The semaphore take, queue send/receive, event wait and sleep are awaitable, the message buffers and the event value
+ * have to be valid until the wait is completed. The other blocking calls block the whole runner thread.
+ */
+#define OS_STACKLESS_BEGIN(p_task)                                                                                                         \
+    switch ((p_task)->lc) {                                                                                                                \
+    case 0u:
+#define OS_STACKLESS_YIELD(p_task)                                                                                                         \
+    do {                                                                                                                                   \
+        (p_task)->lc = (u16_t)__LINE__;                                                                                                    \
+        return STACKLESS_STATE_YIELD_VAL;                                                                                                  \
+    case __LINE__:;                                                                                                                        \
+    } while (0)
+#define OS_STACKLESS_AWAIT(p_task, call)                                                                                                   \
+    do {                                                                                                                                   \
+        (p_task)->lc = (u16_t)__LINE__;                                                                                                    \
+        (p_task)->result = (call);                                                                                                         \
+        if ((p_task)->result == OS_PC_UNAVAILABLE) {                                                                                       \
+            return STACKLESS_STATE_WAIT_VAL;                                                                                               \
+        case __LINE__:                                                                                                                     \
+            os_stackless_result_take(p_task);                                                                                              \
+        }                                                                                                                                  \
+    } while (0)
+#define OS_STACKLESS_SLEEP(p_task, ms) OS_STACKLESS_AWAIT(p_task, os_thread_sleep(ms))
+#define OS_STACKLESS_RESULT(p_task)    ((p_task)->result)
+#define OS_STACKLESS_END(p_task)                                                                                                           \
+    }                                                                                                                                      \
+    (p_task)->lc = 0u;                                                                                                                     \
+    return STACKLESS_STATE_EXIT_VAL
+
 #define OS_STACK_INIT(name, size)                                     STACK_STATIC_VALUE_DEFINE(name, size)
 #define OS_THREAD_INIT(id_name, priority, stack_size, pEntryFn, pArg) INIT_OS_THREAD_DEFINE(id_name, priority, stack_size, pEntryFn, pArg)
 #define OS_TIMER_INIT(id_name, pEntryFunc)                            INIT_OS_TIMER_DEFINE(id_name, pEntryFunc)
+#define OS_TIMER_SERVICE_INIT(id_name, service, priority, stack_size) INIT_OS_TIMER_SERVICE_DEFINE(id_name, service, priority, stack_size)
 #define OS_SEMAPHORE_INIT(id_name, remain, limit)                     INIT_OS_SEMAPHORE_DEFINE(id_name, remain, limit)
 #define OS_MUTEX_INIT(id_name)                                        INIT_OS_MUTEX_DEFINE(id_name)
+#define OS_RWLOCK_INIT(id_name, prefer)                               INIT_OS_RWLOCK_DEFINE(id_name, prefer)
 #define OS_EVT_INIT(id_name, anyMask, modeMask, dirMask, init)        INIT_OS_EVT_DEFINE(id_name, anyMask, modeMask, dirMask, init)
 #define OS_MSGQ_INIT(id_name, pBufAddr, len, num)                     INIT_OS_MSGQ_DEFINE(id_name, pBufAddr, len, num)
 #define OS_POOL_INIT(id_name, pMemAddr, len, num)                     INIT_OS_POOL_DEFINE(id_name, pMemAddr, len, num)
@@ -156,7 +226,7 @@ static inline os_thread_id_t os_thread_init(u32_t *pStackAddr, u32_t size, i16_t
  */
 static inline os_thread_id_t os_thread_name_toId(const char_t *pName)
 {
-    extern _u32_t _impl_thread_name_toId(const _char_t *pName);
+    extern u32_t _impl_thread_name_toId(const char_t *pName);
 
 #if (OS_ID_NODATA)
     return (os_thread_id_t)_impl_thread_name_toId(pName);
@@ -203,6 +273,134 @@ static inline void *os_thread_user_data_get(os_thread_id_t id)
 #endif
 }
 
+/**
+ * @brief Set a thread local storage slot value of the current running thread.
+ *
+ * It's accessed in the thread mode directly without the kernel trap, the call in the interrupt handler is rejected.
+ *
+ * @param slot The slot index, it's less than THREAD_TLS_SLOT_NUMBER.
+ * @param pValue The slot value.
+ *
+ * @return The result of thread local storage operation.
+ */
+static inline i32p_t os_thread_tls_set(u8_t slot, void *pValue)
+{
+    extern i32p_t _impl_thread_tls_set(u8_t slot, void *pValue);
+
+    return _impl_thread_tls_set(slot, pValue);
+}
+
+/**
+ * @brief Get a thread local storage slot value of the current running thread.
+ *
+ * It's accessed in the thread mode directly without the kernel trap, the call in the interrupt handler is rejected.
+ *
+ * @param slot The slot index, it's less than THREAD_TLS_SLOT_NUMBER.
+ *
+ * @return The slot value.
+ */
+static inline void *os_thread_tls_get(u8_t slot)
+{
+    extern void *_impl_thread_tls_get(u8_t slot);
+
+    return _impl_thread_tls_get(slot);
+}
+
+/**
+ * @brief Initialize a stackless task which shares the stack of the runner thread with the other stackless tasks.
+ *
+ * The entry function returns at each yield or wait point and it's called again to resume at the saved point.
+ * The task object has to be zero initialized and stay valid while it's running, it's available when STACKLESS_TASK_ENABLED.
+ *
+ * @param pTask The pointer of the stackless task.
+ * @param pEntryFun The stackless task entry function.
+ * @param pArg The stackless task entry argument.
+ * @param priority The priority to order the stackless task in the wait queues.
+ *
+ * @return The result of stackless task initialization operation.
+ */
+static inline i32p_t os_stackless_init(os_stackless_t *pTask, pStackless_entryFunc_t pEntryFun, void *pArg, i16_t priority)
+{
+    extern i32p_t _impl_stackless_init(os_stackless_t * pTask, pStackless_entryFunc_t pEntryFunc, void *pArg, i16_t priority);
+
+    return _impl_stackless_init(pTask, pEntryFun, pArg, priority);
+}
+
+/**
+ * @brief Take the result of the completed wait of the stackless task, it's called by the OS_STACKLESS_AWAIT.
+ *
+ * @param pTask The pointer of the stackless task.
+ *
+ * @return The result of the wait operation.
+ */
+static inline i32p_t os_stackless_result_take(os_stackless_t *pTask)
+{
+    extern i32p_t _impl_stackless_result_take(os_stackless_t * pTask);
+
+    return _impl_stackless_result_take(pTask);
+}
+
+/**
+ * @brief Change a thread priority at runtime.
+ *
+ * The thread is repositioned in the ready list or in the priority-ordered blocking list which it's waiting on.
+ * If the thread holds a mutex, its priority is recovered to the value at the mutex locking time when it unlocks.
+ *
+ * @param id The thread unique id.
+ * @param priority The new thread priority.
+ *
+ * @return The result of thread priority set operation.
+ */
+static inline i32p_t os_thread_priority_set(os_thread_id_t id, i16_t priority)
+{
+    extern i32p_t _impl_thread_priority_set(u32_t ctx, i16_t priority);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_thread_priority_set((u32_t)id, priority);
+#else
+    return (i32p_t)_impl_thread_priority_set(id.u32_val, priority);
+#endif
+}
+
+/**
+ * @brief Get a thread priority.
+ *
+ * @param id The thread unique id.
+ *
+ * @return The value of the thread priority, the OS_PRIORITY_INVALID indicates the thread is invalid.
+ */
+static inline i16_t os_thread_priority_get(os_thread_id_t id)
+{
+    extern i16_t _impl_thread_priority_get(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (i16_t)_impl_thread_priority_get((u32_t)id);
+#else
+    return (i16_t)_impl_thread_priority_get(id.u32_val);
+#endif
+}
+
+/**
+ * @brief Get the number of the context switch which saved the thread FPU registers.
+ *
+ * The PendSV saves the S16 - S31 registers only for the thread which has used the FPU,
+ * so the zero value indicates the thread never paid the FPU context cost.
+ *
+ * @param id The thread unique id.
+ *
+ * @return The value of the FPU context switch number.
+ */
+static inline u32_t os_thread_fpu_switch_probe(os_thread_id_t id)
+{
+    extern u32_t _impl_thread_fpu_switch_get(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (u32_t)_impl_thread_fpu_switch_get((u32_t)id);
+#else
+    return (u32_t)_impl_thread_fpu_switch_get(id.u32_val);
+#endif
+}
+
 /**
  * @brief Put the current running thread into sleep mode with timeout condition.
  *
@@ -217,6 +415,20 @@ static inline i32p_t os_thread_sleep(u32_t ms)
     return (i32p_t)_impl_thread_sleep(ms);
 }
 
+/**
+ * @brief Put the current running thread into sleep mode with microsecond timeout condition.
+ *
+ * @param us The time user defined, it's limited to the minimum clock interval.
+ *
+ * @return The result of thread sleep operation.
+ */
+static inline i32p_t os_thread_sleep_us(u32_t us)
+{
+    extern i32p_t _impl_thread_sleep(u32_t ms);
+
+    return (i32p_t)_impl_thread_sleep(OS_TIME_US(us));
+}
+
 /**
  * @brief Resume a thread to run.
  *
@@ -345,6 +557,37 @@ static inline os_thread_id_t *os_thread_idle_id_probe(void)
     return _impl_idle_thread_id_get();
 }
 
+/**
+ * @brief Register a low power state for the idle governor, it selects the deepest state whose latency and residency
+ *        fit into the time to the next timeout deadline. The enter function runs with interrupts disabled,
+ *        it returns the sleep time that the kernel clock didn't count, the NULL enter function indicates the core WFI state.
+ *
+ * @param pState The pointer of the low power state, it must be kept valid.
+ *
+ * @return The index of the low power state, otherwise is the error postcode.
+ */
+static inline i32p_t os_idle_state_register(const os_idle_state_t *pState)
+{
+    extern i32p_t _impl_idle_state_register(const struct idle_state *pState);
+
+    return _impl_idle_state_register(pState);
+}
+
+/**
+ * @brief Get the residency statistics of the low power state.
+ *
+ * @param index The index of the low power state.
+ * @param pResidency The pointer of the residency statistics.
+ *
+ * @return The result of the residency get operation.
+ */
+static inline i32p_t os_idle_state_residency_get(u8_t index, os_idle_residency_t *pResidency)
+{
+    extern i32p_t _impl_idle_state_residency_get(u8_t index, struct idle_residency * pResidency);
+
+    return _impl_idle_state_residency_get(index, pResidency);
+}
+
 /**
  * @brief Add a user thread data.
  *
@@ -409,6 +652,26 @@ static inline os_timer_id_t os_timer_automatic(pTimer_callbackFunc_t pEntryFun,
 #endif
 }
 
+/**
+ * @brief Find a timer id by its name.
+ *
+ * @param pName The timer name.
+ *
+ * @return The value of timer unique id.
+ */
+static inline os_timer_id_t os_timer_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_timer_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_timer_id_t)_impl_timer_name_toId(pName);
+#else
+    os_timer_id_t id = {0u};
+    id.u32_val = _impl_timer_name_toId(pName);
+    return id;
+#endif
+}
+
 /**
  * @brief Timer starts operation, be careful if the timer's last time isn't expired or be handled,
  *        the new resume will override it.
@@ -430,6 +693,132 @@ static inline i32p_t os_timer_start(os_timer_id_t id, os_timer_ctrl_t control, o
 #endif
 }
 
+/**
+ * @brief Timer starts operation with microsecond expired time.
+ *
+ * @param id The timer unique id.
+ * @param control It defines the timer running mode.
+ * @param timeout_us The timer expired time, it's limited to the minimum clock interval.
+ *
+ * @return The result of timer start operation.
+ */
+static inline i32p_t os_timer_start_us(os_timer_id_t id, os_timer_ctrl_t control, u32_t timeout_us)
+{
+    return os_timer_start(id, control, OS_TIME_US(timeout_us));
+}
+
+/**
+ * @brief Assign the timer callback to a service thread.
+ *
+ * @param id The timer unique id.
+ * @param service The service number, the OS_TIMER_SERVICE_KERNEL indicates the kernel thread,
+ *                the OS_TIMER_SERVICE_HARD indicates the callback runs in the clock interrupt.
+ *
+ * @return The result of timer service set operation.
+ */
+static inline i32p_t os_timer_service_set(os_timer_id_t id, u8_t service)
+{
+    extern i32p_t _impl_timer_service_set(u32_t ctx, u8_t service);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_timer_service_set((u32_t)id, service);
+#else
+    return (i32p_t)_impl_timer_service_set(id.u32_val, service);
+#endif
+}
+
+/**
+ * @brief Set the periodic timer catch-up policy when the periods are missed.
+ *
+ * @param id The timer unique id.
+ * @param catchup The catch-up policy, skip the missed periods, burst a callback for each missed period,
+ *                or coalesce them into one callback with the missed count.
+ * @param pMissedFun The coalesced callback with the missed count, the NULL indicates the normal callback.
+ *
+ * @return The result of timer catch-up set operation.
+ */
+static inline i32p_t os_timer_catchup_set(os_timer_id_t id, os_timer_catchup_t catchup, pTimer_missedCallbackFunc_t pMissedFun)
+{
+    extern i32p_t _impl_timer_catchup_set(u32_t ctx, u8_t catchup, pTimer_missedCallbackFunc_t pMissedFun);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_timer_catchup_set((u32_t)id, (u8_t)catchup, pMissedFun);
+#else
+    return (i32p_t)_impl_timer_catchup_set(id.u32_val, (u8_t)catchup, pMissedFun);
+#endif
+}
+
+/**
+ * @brief Get the total number of the missed periods since the timer started.
+ *
+ * @param id The timer unique id.
+ *
+ * @return The value of the timer overrun counter.
+ */
+static inline u32_t os_timer_overrun_get(os_timer_id_t id)
+{
+    extern u32_t _impl_timer_overrun_get(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (u32_t)_impl_timer_overrun_get((u32_t)id);
+#else
+    return (u32_t)_impl_timer_overrun_get(id.u32_val);
+#endif
+}
+
+/**
+ * @brief Get the timer lateness statistics, the lateness is how late the expiry is handled after its deadline.
+ *
+ * @param id The timer unique id.
+ * @param pLateness The pointer of the lateness statistics.
+ *
+ * @return The result of timer lateness get operation.
+ */
+static inline i32p_t os_timer_lateness_get(os_timer_id_t id, os_timer_lateness_t *pLateness)
+{
+    extern i32p_t _impl_timer_lateness_get(u32_t ctx, struct timer_lateness * pLateness);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_timer_lateness_get((u32_t)id, pLateness);
+#else
+    return (i32p_t)_impl_timer_lateness_get(id.u32_val, pLateness);
+#endif
+}
+
+/**
+ * @brief Get the lateness statistics of all timeout expiries, includes the thread timeout and the clamped interval number.
+ *
+ * @param pLateness The pointer of the lateness statistics.
+ *
+ * @return The result of system lateness get operation.
+ */
+static inline i32p_t os_timer_system_lateness_get(os_timer_lateness_t *pLateness)
+{
+    extern i32p_t _impl_timer_system_lateness_get(struct timer_lateness * pLateness);
+
+    return (i32p_t)_impl_timer_system_lateness_get(pLateness);
+}
+
+/**
+ * @brief Set the timer slack time, the timer expiry is allowed to be delayed within it
+ *        in order to be coalesced with the other nearby expiries into one clock interrupt.
+ *
+ * @param id The timer unique id.
+ * @param slack_us The tolerance window time (us), the zero value indicates an exact expiry.
+ *
+ * @return The result of timer slack set operation.
+ */
+static inline i32p_t os_timer_slack_set(os_timer_id_t id, u32_t slack_us)
+{
+    extern i32p_t _impl_timer_slack_set(u32_t ctx, u32_t slack_us);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_timer_slack_set((u32_t)id, slack_us);
+#else
+    return (i32p_t)_impl_timer_slack_set(id.u32_val, slack_us);
+#endif
+}
+
 /**
  * @brief timer stops operation.
  *
@@ -501,6 +890,18 @@ static inline u32_t os_timer_system_total_ms(void)
     return (u32_t)_impl_timer_total_system_ms_get();
 }
 
+/**
+ * @brief Get the kernel RTOS 64-bit monotonic system time (us), it's wrap-safe for the timestamp and latency measurement.
+ *
+ * @return The value of the total system time (us).
+ */
+static inline u64_t os_timer_system_total_us(void)
+{
+    extern u64_t _impl_timer_total_system_us64_get(void);
+
+    return (u64_t)_impl_timer_total_system_us64_get();
+}
+
 /**
  * @brief System busy wait (us).
  *
@@ -513,6 +914,37 @@ static inline u32_t os_timer_system_busy_wait(u32_t us)
     return _impl_system_busy_wait(us);
 }
 
+/**
+ * @brief Change the core clock frequency at runtime for the dynamic voltage and frequency scaling.
+ *
+ * The elapsed time is accounted at the old frequency, then the switch function is called with the
+ * clock counter frozen, and the next timeout interval is reprogrammed at the new frequency.
+ * The time spent in the switch function isn't counted into the system time.
+ *
+ * @param mhz The new core clock frequency (MHz).
+ * @param pSwitchFun The function to switch the core clock hardware, it supported NULL pointer.
+ *
+ * @return The result of core clock set operation.
+ */
+static inline i32p_t os_timer_system_clock_set(u32_t mhz, pClock_switchFunc_t pSwitchFun)
+{
+    extern i32p_t _impl_timer_core_clock_set(u32_t mhz, pClock_switchFunc_t pSwitchFun);
+
+    return _impl_timer_core_clock_set(mhz, pSwitchFun);
+}
+
+/**
+ * @brief Get the current core clock frequency.
+ *
+ * @return The value of the core clock frequency (MHz).
+ */
+static inline u32_t os_timer_system_clock_get(void)
+{
+    extern u32_t _impl_timer_core_clock_get(void);
+
+    return _impl_timer_core_clock_get();
+}
+
 /**
  * @brief Initialize a new semaphore.
  *
@@ -522,9 +954,9 @@ static inline u32_t os_timer_system_busy_wait(u32_t us)
  *
  * @return The semaphore unique id.
  */
-static inline os_sem_id_t os_sem_init(u8_t remain, u8_t limit, const char_t *pName)
+static inline os_sem_id_t os_sem_init(u32_t remain, u32_t limit, const char_t *pName)
 {
-    extern u32_t _impl_semaphore_init(u8_t remainCount, u8_t limitCount, const char_t *pName);
+    extern u32_t _impl_semaphore_init(u32_t remainCount, u32_t limitCount, const char_t *pName);
 
 #if (OS_ID_NODATA)
     return (os_sem_id_t)_impl_semaphore_init(remain, limit, pName);
@@ -537,6 +969,26 @@ static inline os_sem_id_t os_sem_init(u8_t remain, u8_t limit, const char_t *pNa
 #endif
 }
 
+/**
+ * @brief Find a semaphore id by its name.
+ *
+ * @param pName The semaphore name.
+ *
+ * @return The value of semaphore unique id.
+ */
+static inline os_sem_id_t os_sem_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_semaphore_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_sem_id_t)_impl_semaphore_name_toId(pName);
+#else
+    os_sem_id_t id = {0u};
+    id.u32_val = _impl_semaphore_name_toId(pName);
+    return id;
+#endif
+}
+
 /**
  * @brief Take a semaphore count away with timeout option.
  *
@@ -574,120 +1026,401 @@ static inline i32p_t os_sem_give(os_sem_id_t id)
 }
 
 /**
- * @brief Flush the semaphore to release all the avaliable count.
+ * @brief Take several semaphore counts away together with timeout option.
+ *
+ * @param id The semaphore unique id.
+ * @param count The number of the taking count.
+ * @param timeout_ms The blocking timeout value.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_take_n(os_sem_id_t id, u32_t count, u32_t timeout_ms)
+{
+    extern i32p_t _impl_semaphore_take_n(u32_t ctx, u32_t count, u32_t timeout_ms);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_semaphore_take_n((u32_t)id, count, timeout_ms);
+#else
+    return (i32p_t)_impl_semaphore_take_n(id.u32_val, count, timeout_ms);
+#endif
+}
+
+/**
+ * @brief Give several semaphore counts back together, the blocking threads are woken up in one pass.
+ *
+ * @param id The semaphore unique id.
+ * @param count The number of the giving count.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_give_n(os_sem_id_t id, u32_t count)
+{
+    extern i32p_t _impl_semaphore_give_n(u32_t ctx, u32_t count);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_semaphore_give_n((u32_t)id, count);
+#else
+    return (i32p_t)_impl_semaphore_give_n(id.u32_val, count);
+#endif
+}
+
+/**
+ * @brief Flush the semaphore to release all the avaliable count.
+ *
+ * @param id The semaphore unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_flush(os_sem_id_t id)
+{
+    extern i32p_t _impl_semaphore_flush(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_semaphore_flush((u32_t)id);
+#else
+    return (i32p_t)_impl_semaphore_flush(id.u32_val);
+#endif
+}
+
+/**
+ * @brief Set the blocking threads waiting order of the semaphore, it's allowed when no thread is blocking.
+ *
+ * The priority order wakes up the highest priority thread first, the same priority threads in the arrival order.
+ * The FIFO order wakes up the threads in the arrival order only, both orders enqueue the thread in constant time.
+ *
+ * @param id The semaphore unique id.
+ * @param order The waiting order.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_wait_order_set(os_sem_id_t id, os_wait_order_t order)
+{
+    extern i32p_t _impl_semaphore_wait_order_set(u32_t ctx, u8_t order);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_semaphore_wait_order_set((u32_t)id, (u8_t)order);
+#else
+    return (i32p_t)_impl_semaphore_wait_order_set(id.u32_val, (u8_t)order);
+#endif
+}
+
+/**
+ * @brief Semaphore delete.
+ *
+ * @param id The semaphore unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_delete(os_sem_id_t id)
+{
+    extern i32p_t _impl_semaphore_delete(u32_t ctx);
+
+    i32p_t pc = 0;
+#if (OS_ID_NODATA)
+    pc = _impl_semaphore_delete((u32_t)id);
+    id = NULL;
+#else
+    pc = _impl_semaphore_delete(id.u32_val);
+    id.p_val = NULL;
+#endif
+    return pc;
+}
+
+/**
+ * @brief Initialize a new mutex.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The mutex unique id.
+ */
+static inline os_mutex_id_t os_mutex_init(const char_t *pName)
+{
+    extern u32_t _impl_mutex_init(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_mutex_id_t)_impl_mutex_init(pName);
+#else
+    os_mutex_id_t id = {0u};
+    id.u32_val = _impl_mutex_init(pName);
+    id.pName = pName;
+
+    return id;
+#endif
+}
+
+/**
+ * @brief Find a mutex id by its name.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The value of mutex unique id.
+ */
+static inline os_mutex_id_t os_mutex_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_mutex_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_mutex_id_t)_impl_mutex_name_toId(pName);
+#else
+    os_mutex_id_t id = {0u};
+    id.u32_val = _impl_mutex_name_toId(pName);
+    return id;
+#endif
+}
+
+/**
+ * @brief Mutex lock to avoid another thread access this resource.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_lock(os_mutex_id_t id)
+{
+    extern i32p_t _impl_mutex_lock(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_mutex_lock((u32_t)id);
+#else
+    return (i32p_t)_impl_mutex_lock(id.u32_val);
+#endif
+}
+
+/**
+ * @brief Mutex unlock to allow another access the resource.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_unlock(os_mutex_id_t id)
+{
+    extern i32p_t _impl_mutex_unlock(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_mutex_unlock((u32_t)id);
+#else
+    return (i32p_t)_impl_mutex_unlock(id.u32_val);
+#endif
+}
+
+/**
+ * @brief Condition wait to unlock the mutex and block until it's signaled, the mutex is locked again when it returns.
+ *
+ * @param id The mutex unique id.
+ * @param timeout_ms The blocking timeout value.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_cond_wait(os_mutex_id_t id, u32_t timeout_ms)
+{
+    extern i32p_t _impl_mutex_cond_wait(u32_t ctx, u32_t timeout_ms);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_mutex_cond_wait((u32_t)id, timeout_ms);
+#else
+    return (i32p_t)_impl_mutex_cond_wait(id.u32_val, timeout_ms);
+#endif
+}
+
+/**
+ * @brief Condition signal to wake up the highest priority waiting thread.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_cond_signal(os_mutex_id_t id)
+{
+    extern i32p_t _impl_mutex_cond_signal(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_mutex_cond_signal((u32_t)id);
+#else
+    return (i32p_t)_impl_mutex_cond_signal(id.u32_val);
+#endif
+}
+
+/**
+ * @brief Condition broadcast to wake up all waiting threads.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_cond_broadcast(os_mutex_id_t id)
+{
+    extern i32p_t _impl_mutex_cond_broadcast(u32_t ctx);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_mutex_cond_broadcast((u32_t)id);
+#else
+    return (i32p_t)_impl_mutex_cond_broadcast(id.u32_val);
+#endif
+}
+
+/**
+ * @brief Set the blocking threads waiting order of the mutex, it's allowed when no thread is blocking.
+ *
+ * The priority order wakes up the highest priority thread first, the same priority threads in the arrival order.
+ * The FIFO order wakes up the threads in the arrival order only, both orders enqueue the thread in constant time.
+ *
+ * @param id The mutex unique id.
+ * @param order The waiting order.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_wait_order_set(os_mutex_id_t id, os_wait_order_t order)
+{
+    extern i32p_t _impl_mutex_wait_order_set(u32_t ctx, u8_t order);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_mutex_wait_order_set((u32_t)id, (u8_t)order);
+#else
+    return (i32p_t)_impl_mutex_wait_order_set(id.u32_val, (u8_t)order);
+#endif
+}
+
+/**
+ * @brief Mutex delete.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_delete(os_mutex_id_t id)
+{
+    extern i32p_t _impl_mutex_delete(u32_t ctx);
+
+    i32p_t pc = 0;
+#if (OS_ID_NODATA)
+    pc = _impl_mutex_delete((u32_t)id);
+    id = NULL;
+#else
+    pc = _impl_mutex_delete(id.u32_val);
+    id.p_val = NULL;
+#endif
+    return pc;
+}
+
+/**
+ * @brief Initialize a new rwlock.
  *
- * @param id The semaphore unique id.
+ * @param writerPrefer The new readers wait behind the blocking writers when it's true.
+ * @param pName The rwlock name.
  *
- * @return The result of the operation.
+ * @return The rwlock unique id.
  */
-static inline i32p_t os_sem_flush(os_sem_id_t id)
+static inline os_rwlock_id_t os_rwlock_init(b_t writerPrefer, const char_t *pName)
 {
-    extern i32p_t _impl_semaphore_flush(u32_t ctx);
+    extern u32_t _impl_rwlock_init(b_t writerPrefer, const char_t *pName);
 
 #if (OS_ID_NODATA)
-    return (i32p_t)_impl_semaphore_flush((u32_t)id);
+    return (os_rwlock_id_t)_impl_rwlock_init(writerPrefer, pName);
 #else
-    return (i32p_t)_impl_semaphore_flush(id.u32_val);
+    os_rwlock_id_t id = {0u};
+    id.u32_val = _impl_rwlock_init(writerPrefer, pName);
+    id.pName = pName;
+
+    return id;
 #endif
 }
 
 /**
- * @brief Semaphore delete.
+ * @brief Find a rwlock id by its name.
  *
- * @param id The semaphore unique id.
+ * @param pName The rwlock name.
  *
- * @return The result of the operation.
+ * @return The value of rwlock unique id.
  */
-static inline i32p_t os_sem_delete(os_sem_id_t id)
+static inline os_rwlock_id_t os_rwlock_name_toId(const char_t *pName)
 {
-    extern i32p_t _impl_semaphore_delete(u32_t ctx);
+    extern u32_t _impl_rwlock_name_toId(const char_t *pName);
 
-    i32p_t pc = 0;
 #if (OS_ID_NODATA)
-    pc = _impl_semaphore_delete((u32_t)id);
-    id = NULL;
+    return (os_rwlock_id_t)_impl_rwlock_name_toId(pName);
 #else
-    pc = _impl_semaphore_delete(id.u32_val);
-    id.p_val = NULL;
+    os_rwlock_id_t id = {0u};
+    id.u32_val = _impl_rwlock_name_toId(pName);
+    return id;
 #endif
-    return pc;
 }
 
 /**
- * @brief Initialize a new mutex.
+ * @brief Rwlock shared lock that allows many readers access this resource together.
  *
- * @param pName The mutex name.
+ * @param id The rwlock unique id.
+ * @param timeout_ms The blocking timeout value.
  *
- * @return The mutex unique id.
+ * @return The result of the operation.
  */
-static inline os_mutex_id_t os_mutex_init(const char_t *pName)
+static inline i32p_t os_rwlock_read_lock(os_rwlock_id_t id, u32_t timeout_ms)
 {
-    extern u32_t _impl_mutex_init(const char_t *pName);
+    extern i32p_t _impl_rwlock_read_lock(u32_t ctx, u32_t timeout_ms);
 
 #if (OS_ID_NODATA)
-    return (os_mutex_id_t)_impl_mutex_init(pName);
+    return (i32p_t)_impl_rwlock_read_lock((u32_t)id, timeout_ms);
 #else
-    os_mutex_id_t id = {0u};
-    id.u32_val = _impl_mutex_init(pName);
-    id.pName = pName;
-
-    return id;
+    return (i32p_t)_impl_rwlock_read_lock(id.u32_val, timeout_ms);
 #endif
 }
 
 /**
- * @brief Mutex lock to avoid another thread access this resource.
+ * @brief Rwlock exclusive lock to avoid another thread access this resource.
  *
- * @param id The mutex unique id.
+ * @param id The rwlock unique id.
+ * @param timeout_ms The blocking timeout value.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_mutex_lock(os_mutex_id_t id)
+static inline i32p_t os_rwlock_write_lock(os_rwlock_id_t id, u32_t timeout_ms)
 {
-    extern i32p_t _impl_mutex_lock(u32_t ctx);
+    extern i32p_t _impl_rwlock_write_lock(u32_t ctx, u32_t timeout_ms);
 
 #if (OS_ID_NODATA)
-    return (i32p_t)_impl_mutex_lock((u32_t)id);
+    return (i32p_t)_impl_rwlock_write_lock((u32_t)id, timeout_ms);
 #else
-    return (i32p_t)_impl_mutex_lock(id.u32_val);
+    return (i32p_t)_impl_rwlock_write_lock(id.u32_val, timeout_ms);
 #endif
 }
 
 /**
- * @brief Mutex unlock to allow another access the resource.
+ * @brief Rwlock unlock to release the shared or exclusive access.
  *
- * @param id The mutex unique id.
+ * The thread that doesn't hold the lock is rejected.
+ *
+ * @param id The rwlock unique id.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_mutex_unlock(os_mutex_id_t id)
+static inline i32p_t os_rwlock_unlock(os_rwlock_id_t id)
 {
-    extern i32p_t _impl_mutex_unlock(u32_t ctx);
+    extern i32p_t _impl_rwlock_unlock(u32_t ctx);
 
 #if (OS_ID_NODATA)
-    return (i32p_t)_impl_mutex_unlock((u32_t)id);
+    return (i32p_t)_impl_rwlock_unlock((u32_t)id);
 #else
-    return (i32p_t)_impl_mutex_unlock(id.u32_val);
+    return (i32p_t)_impl_rwlock_unlock(id.u32_val);
 #endif
 }
 
 /**
- * @brief Mutex delete.
+ * @brief Rwlock delete.
  *
- * @param id The mutex unique id.
+ * @param id The rwlock unique id.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_mutex_delete(os_mutex_id_t id)
+static inline i32p_t os_rwlock_delete(os_rwlock_id_t id)
 {
-    extern i32p_t _impl_mutex_delete(u32_t ctx);
+    extern i32p_t _impl_rwlock_delete(u32_t ctx);
 
     i32p_t pc = 0;
 #if (OS_ID_NODATA)
-    pc = _impl_mutex_delete((u32_t)id);
+    pc = _impl_rwlock_delete((u32_t)id);
     id = NULL;
 #else
-    pc = _impl_mutex_delete(id.u32_val);
+    pc = _impl_rwlock_delete(id.u32_val);
     id.p_val = NULL;
 #endif
     return pc;
@@ -705,9 +1438,9 @@ static inline i32p_t os_mutex_delete(os_mutex_id_t id)
  * @return The event unique id.
  *     ...
  */
-static inline os_evt_id_t os_evt_init(u32_t anyMask, u32_t modeMask, u32_t dirMask, u32_t init, const char_t *pName)
+static inline os_evt_id_t os_evt_init(u64_t anyMask, u64_t modeMask, u64_t dirMask, u64_t init, const char_t *pName)
 {
-    extern u32_t _impl_event_init(u32_t anyMask, u32_t modeMask, u32_t dirMask, u32_t init, const char_t *pName);
+    extern u32_t _impl_event_init(u64_t anyMask, u64_t modeMask, u64_t dirMask, u64_t init, const char_t *pName);
 
 #if (OS_ID_NODATA)
     return (os_evt_id_t)_impl_event_init(anyMask, modeMask, dirMask, init, pName);
@@ -720,6 +1453,26 @@ static inline os_evt_id_t os_evt_init(u32_t anyMask, u32_t modeMask, u32_t dirMa
 #endif
 }
 
+/**
+ * @brief Find a event id by its name.
+ *
+ * @param pName The event name.
+ *
+ * @return The value of event unique id.
+ */
+static inline os_evt_id_t os_evt_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_event_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_evt_id_t)_impl_event_name_toId(pName);
+#else
+    os_evt_id_t id = {0u};
+    id.u32_val = _impl_event_name_toId(pName);
+    return id;
+#endif
+}
+
 /**
  * @brief Read or write the event signal value.
  *
@@ -728,9 +1481,9 @@ static inline os_evt_id_t os_evt_init(u32_t anyMask, u32_t modeMask, u32_t dirMa
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_evt_value_get(os_evt_id_t id, u32_t *pValue)
+static inline i32p_t os_evt_value_get(os_evt_id_t id, u64_t *pValue)
 {
-    extern i32p_t _impl_event_value_get(u32_t ctx, u32_t * pValue);
+    extern i32p_t _impl_event_value_get(u32_t ctx, u64_t * pValue);
 
 #if (OS_ID_NODATA)
     return (i32p_t)_impl_event_value_get((u32_t)id, pValue);
@@ -749,9 +1502,9 @@ static inline i32p_t os_evt_value_get(os_evt_id_t id, u32_t *pValue)
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_evt_set(os_evt_id_t id, u32_t set, u32_t clear, u32_t toggle)
+static inline i32p_t os_evt_set(os_evt_id_t id, u64_t set, u64_t clear, u64_t toggle)
 {
-    extern i32p_t _impl_event_set(u32_t ctx, u32_t set, u32_t clear, u32_t toggle);
+    extern i32p_t _impl_event_set(u32_t ctx, u64_t set, u64_t clear, u64_t toggle);
 
 #if (OS_ID_NODATA)
     return (i32p_t)_impl_event_set((u32_t)id, set, clear, toggle);
@@ -761,23 +1514,68 @@ static inline i32p_t os_evt_set(os_evt_id_t id, u32_t set, u32_t clear, u32_t to
 }
 
 /**
- * @brief Wait a trigger event.
+ * @brief Wait a trigger event, any of the listen bits triggered wakes it up.
+ *
+ * @param id The event unique id.
+ * @param pEvtData The pointer of event value.
+ * @param listen_mask Current thread listen which bits in the event.
+ * @param timeout_ms The event wait timeout setting.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_evt_wait(os_evt_id_t id, os_evt_val_t *pEvtData, u64_t listen_mask, os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_event_wait(u32_t ctx, struct evt_val * pEvtData, u64_t listen_mask, u8_t option, u32_t timeout_ms);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_event_wait((u32_t)id, pEvtData, listen_mask, OS_EVT_WAIT_ANY, (u32_t)timeout_ms);
+#else
+    return (i32p_t)_impl_event_wait(id.u32_val, pEvtData, listen_mask, OS_EVT_WAIT_ANY, (u32_t)timeout_ms);
+#endif
+}
+
+/**
+ * @brief Wait a trigger event with the wait any or wait all option.
  *
  * @param id The event unique id.
  * @param pEvtData The pointer of event value.
  * @param listen_mask Current thread listen which bits in the event.
+ * @param option The wait any or wait all of the listen bits option.
  * @param timeout_ms The event wait timeout setting.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_evt_wait(os_evt_id_t id, os_evt_val_t *pEvtData, u32_t listen_mask, os_timeout_t timeout_ms)
+static inline i32p_t os_evt_wait_option(os_evt_id_t id, os_evt_val_t *pEvtData, u64_t listen_mask, os_evt_wait_opt_t option,
+                                        os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_event_wait(u32_t ctx, struct evt_val * pEvtData, u64_t listen_mask, u8_t option, u32_t timeout_ms);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_event_wait((u32_t)id, pEvtData, listen_mask, (u8_t)option, (u32_t)timeout_ms);
+#else
+    return (i32p_t)_impl_event_wait(id.u32_val, pEvtData, listen_mask, (u8_t)option, (u32_t)timeout_ms);
+#endif
+}
+
+/**
+ * @brief Set the blocking threads waiting order of the event, it's allowed when no thread is blocking.
+ *
+ * The priority order wakes up the highest priority thread first, the same priority threads in the arrival order.
+ * The FIFO order wakes up the threads in the arrival order only, both orders enqueue the thread in constant time.
+ *
+ * @param id The event unique id.
+ * @param order The waiting order.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_evt_wait_order_set(os_evt_id_t id, os_wait_order_t order)
 {
-    extern i32p_t _impl_event_wait(u32_t ctx, struct evt_val * pEvtData, u32_t listen_mask, u32_t timeout_ms);
+    extern i32p_t _impl_event_wait_order_set(u32_t ctx, u8_t order);
 
 #if (OS_ID_NODATA)
-    return (i32p_t)_impl_event_wait((u32_t)id, pEvtData, listen_mask, (u32_t)timeout_ms);
+    return (i32p_t)_impl_event_wait_order_set((u32_t)id, (u8_t)order);
 #else
-    return (i32p_t)_impl_event_wait(id.u32_val, pEvtData, listen_mask, (u32_t)timeout_ms);
+    return (i32p_t)_impl_event_wait_order_set(id.u32_val, (u8_t)order);
 #endif
 }
 
@@ -829,6 +1627,26 @@ static inline os_msgq_id_t os_msgq_init(const void *pBufferAddr, u16_t len, u16_
 #endif
 }
 
+/**
+ * @brief Find a message queue id by its name.
+ *
+ * @param pName The message queue name.
+ *
+ * @return The value of message queue unique id.
+ */
+static inline os_msgq_id_t os_msgq_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_queue_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_msgq_id_t)_impl_queue_name_toId(pName);
+#else
+    os_msgq_id_t id = {0u};
+    id.u32_val = _impl_queue_name_toId(pName);
+    return id;
+#endif
+}
+
 /**
  * @brief Send a queue message.
  *
@@ -873,6 +1691,28 @@ static inline i32p_t os_msgq_get(os_msgq_id_t id, const u8_t *pUserBuffer, u16_t
 #endif
 }
 
+/**
+ * @brief Set the blocking threads waiting order of the queue, it's allowed when no thread is blocking.
+ *
+ * The priority order wakes up the highest priority thread first, the same priority threads in the arrival order.
+ * The FIFO order wakes up the threads in the arrival order only, both orders enqueue the thread in constant time.
+ *
+ * @param id The queue unique id.
+ * @param order The waiting order.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_msgq_wait_order_set(os_msgq_id_t id, os_wait_order_t order)
+{
+    extern i32p_t _impl_queue_wait_order_set(u32_t ctx, u8_t order);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_queue_wait_order_set((u32_t)id, (u8_t)order);
+#else
+    return (i32p_t)_impl_queue_wait_order_set(id.u32_val, (u8_t)order);
+#endif
+}
+
 /**
  * @brief Delete a message queue.
  *
@@ -939,6 +1779,26 @@ static inline os_pool_id_t os_pool_init(const void *pMemAddr, u16_t size, u16_t
 #endif
 }
 
+/**
+ * @brief Find a memory pool id by its name.
+ *
+ * @param pName The memory pool name.
+ *
+ * @return The value of memory pool unique id.
+ */
+static inline os_pool_id_t os_pool_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_pool_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_pool_id_t)_impl_pool_name_toId(pName);
+#else
+    os_pool_id_t id = {0u};
+    id.u32_val = _impl_pool_name_toId(pName);
+    return id;
+#endif
+}
+
 /**
  * @brief Take a message pool resource.
  *
@@ -979,6 +1839,28 @@ static inline i32p_t os_pool_release(os_pool_id_t id, void **ppUserMem)
 #endif
 }
 
+/**
+ * @brief Set the blocking threads waiting order of the pool, it's allowed when no thread is blocking.
+ *
+ * The priority order wakes up the highest priority thread first, the same priority threads in the arrival order.
+ * The FIFO order wakes up the threads in the arrival order only, both orders enqueue the thread in constant time.
+ *
+ * @param id The pool unique id.
+ * @param order The waiting order.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_pool_wait_order_set(os_pool_id_t id, os_wait_order_t order)
+{
+    extern i32p_t _impl_pool_wait_order_set(u32_t ctx, u8_t order);
+
+#if (OS_ID_NODATA)
+    return (i32p_t)_impl_pool_wait_order_set((u32_t)id, (u8_t)order);
+#else
+    return (i32p_t)_impl_pool_wait_order_set(id.u32_val, (u8_t)order);
+#endif
+}
+
 /**
  * @brief Delete memory pool.
  *
@@ -1023,6 +1905,26 @@ static inline os_publish_id_t os_publish_init(const char_t *pName)
 #endif
 }
 
+/**
+ * @brief Find a publisher id by its name.
+ *
+ * @param pName The publisher name.
+ *
+ * @return The value of publisher unique id.
+ */
+static inline os_publish_id_t os_publish_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_publish_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_publish_id_t)_impl_publish_name_toId(pName);
+#else
+    os_publish_id_t id = {0u};
+    id.u32_val = _impl_publish_name_toId(pName);
+    return id;
+#endif
+}
+
 /**
  * @brief Publisher Submits the report data.
  *
@@ -1067,6 +1969,26 @@ static inline os_subscribe_id_t os_subscribe_init(void *pDataAddr, u16_t size, c
 #endif
 }
 
+/**
+ * @brief Find a subscriber id by its name.
+ *
+ * @param pName The subscriber name.
+ *
+ * @return The value of subscriber unique id.
+ */
+static inline os_subscribe_id_t os_subscribe_name_toId(const char_t *pName)
+{
+    extern u32_t _impl_subscribe_name_toId(const char_t *pName);
+
+#if (OS_ID_NODATA)
+    return (os_subscribe_id_t)_impl_subscribe_name_toId(pName);
+#else
+    os_subscribe_id_t id = {0u};
+    id.u32_val = _impl_subscribe_name_toId(pName);
+    return id;
+#endif
+}
+
 /**
  * @brief To check if the publisher submits new data and that is not applied by subscriber.
  *
@@ -1137,7 +2059,7 @@ static inline i32p_t os_subscribe_data_apply(os_subscribe_id_t subscribe_id, voi
 #if (OS_ID_NODATA)
 static inline b_t os_id_is_invalid(void *id)
 {
-    return (id == NULL) ? true : false;
+    return ((id == NULL) || ((u32_t)id == OS_INVALID_ID_VAL)) ? true : false;
 }
 #else
 static inline b_t os_id_is_invalid(struct os_id id)
@@ -1188,6 +2110,147 @@ static inline void os_kernel_unlock(void)
     _impl_kernel_schedule_unlock();
 }
 
+/**
+ * @brief Reset the kernel transaction to record the new operations.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ *
+ * @return The result of the transaction init operation.
+ */
+static inline i32p_t os_kernel_transaction_init(os_transaction_t *pTrans)
+{
+    extern i32p_t _impl_kernel_transaction_init(struct kernel_transaction * pTrans);
+
+    return _impl_kernel_transaction_init(pTrans);
+}
+
+/**
+ * @brief Record a semaphore give operation into the kernel transaction.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ * @param id The semaphore unique id.
+ *
+ * @return The result of the transaction record operation.
+ */
+static inline i32p_t os_kernel_transaction_sem_give(os_transaction_t *pTrans, os_sem_id_t id)
+{
+    extern i32p_t _impl_kernel_transaction_add(struct kernel_transaction * pTrans, const struct transaction_operation *pOper);
+
+    struct transaction_operation oper = {.type = TRANSACTION_OPER_SEM_GIVE_VAL};
+#if (OS_ID_NODATA)
+    oper.ctx = (u32_t)id;
+#else
+    oper.ctx = id.u32_val;
+#endif
+    return _impl_kernel_transaction_add(pTrans, &oper);
+}
+
+/**
+ * @brief Record an event set operation into the kernel transaction.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ * @param id The event unique id.
+ * @param set The event value bits set.
+ * @param clear The event value bits clear.
+ * @param toggle The event value bits toggle.
+ *
+ * @return The result of the transaction record operation.
+ */
+static inline i32p_t os_kernel_transaction_evt_set(os_transaction_t *pTrans, os_evt_id_t id, u64_t set, u64_t clear, u64_t toggle)
+{
+    extern i32p_t _impl_kernel_transaction_add(struct kernel_transaction * pTrans, const struct transaction_operation *pOper);
+
+    struct transaction_operation oper = {.type = TRANSACTION_OPER_EVT_SET_VAL};
+#if (OS_ID_NODATA)
+    oper.ctx = (u32_t)id;
+#else
+    oper.ctx = id.u32_val;
+#endif
+    oper.arg.evt.set = set;
+    oper.arg.evt.clear = clear;
+    oper.arg.evt.toggle = toggle;
+    return _impl_kernel_transaction_add(pTrans, &oper);
+}
+
+/**
+ * @brief Record a queue message send operation into the kernel transaction, it never blocks at the commit.
+ *
+ * The message is copied into the queue at the commit, the buffer must be kept until the transaction committed.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ * @param id The queue unique id.
+ * @param pUserBuffer The pointer of the message buffer address.
+ * @param size The queue buffer size, the default 0 means that it use the init item size.
+ * @param isToFront The direction of the message operation.
+ *
+ * @return The result of the transaction record operation.
+ */
+static inline i32p_t os_kernel_transaction_msgq_put(os_transaction_t *pTrans, os_msgq_id_t id, const u8_t *pUserBuffer, u16_t size,
+                                                    b_t isToFront)
+{
+    extern i32p_t _impl_kernel_transaction_add(struct kernel_transaction * pTrans, const struct transaction_operation *pOper);
+
+    struct transaction_operation oper = {.type = TRANSACTION_OPER_MSGQ_PUT_VAL};
+#if (OS_ID_NODATA)
+    oper.ctx = (u32_t)id;
+#else
+    oper.ctx = id.u32_val;
+#endif
+    oper.arg.msgq.pUserBuffer = pUserBuffer;
+    oper.arg.msgq.size = size;
+    oper.arg.msgq.isToFront = isToFront;
+    return _impl_kernel_transaction_add(pTrans, &oper);
+}
+
+/**
+ * @brief Execute all recorded operations in one privileged entry with one schedule decision at the end.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ *
+ * @return The first failed operation result, otherwise return 0.
+ */
+static inline i32p_t os_kernel_transaction_commit(os_transaction_t *pTrans)
+{
+    extern i32p_t _impl_kernel_transaction_commit(struct kernel_transaction * pTrans);
+
+    return _impl_kernel_transaction_commit(pTrans);
+}
+
+/**
+ * @brief Get the operation result after the kernel transaction committed.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ * @param index The operation index in the recorded order.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_kernel_transaction_result(os_transaction_t *pTrans, u8_t index)
+{
+    if ((!pTrans) || (index >= pTrans->number)) {
+        return PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    return pTrans->operation[index].result;
+}
+
+/**
+ * @brief Register the context switch hooks at runtime, it requires the SWITCH_HOOK_DYNAMIC_ENABLED.
+ *
+ * The hooks run in the PendSV with the thread id, the switch-out hook runs before the switch-in hook.
+ * They must be short and not call any kernel interface. The NULL hook is removed.
+ *
+ * @param pOutFunc The hook function of the switching out thread.
+ * @param pInFunc The hook function of the switching in thread.
+ *
+ * @return The result of the hook register operation.
+ */
+static inline i32p_t os_kernel_switch_hook_register(pSwitch_hookFunc_t pOutFunc, pSwitch_hookFunc_t pInFunc)
+{
+    extern i32p_t _impl_kernel_switch_hook_register(pSwitch_hookFunc_t pOutFunc, pSwitch_hookFunc_t pInFunc);
+
+    return _impl_kernel_switch_hook_register(pOutFunc, pInFunc);
+}
+
 /**
  * @brief Trace At-RTOS firmware version.
  *
@@ -1246,6 +2309,7 @@ typedef struct {
     os_thread_id_t (*thread_init)(u32_t *, u32_t, i16_t, pThread_entryFunc_t, void *, const char_t *);
     os_thread_id_t (*thread_name_toId)(const char_t *);
     i32p_t (*thread_sleep)(u32_t);
+    i32p_t (*thread_sleep_us)(u32_t);
     i32p_t (*thread_resume)(os_thread_id_t);
     i32p_t (*thread_suspend)(os_thread_id_t);
     i32p_t (*thread_yield)(void);
@@ -1254,49 +2318,93 @@ typedef struct {
     os_thread_id_t (*thread_id_self)(void);
     i32p_t (*thread_user_data_set)(os_thread_id_t, void *);
     void *(*thread_user_data_get)(os_thread_id_t);
+    i32p_t (*thread_tls_set)(u8_t, void *);
+    void *(*thread_tls_get)(u8_t);
+    i32p_t (*stackless_init)(os_stackless_t *, pStackless_entryFunc_t, void *, i16_t);
     void (*thread_idle_fn_register)(const pThread_entryFunc_t);
     os_thread_id_t *(*thread_idle_id_probe)(void);
+    i32p_t (*idle_state_register)(const os_idle_state_t *);
+    i32p_t (*idle_state_residency_get)(u8_t, os_idle_residency_t *);
     u32_t (*thread_stack_free_size_probe)(os_thread_id_t);
+    u32_t (*thread_fpu_switch_probe)(os_thread_id_t);
+    i32p_t (*thread_priority_set)(os_thread_id_t, i16_t);
+    i16_t (*thread_priority_get)(os_thread_id_t);
 
     os_timer_id_t (*timer_init)(pTimer_callbackFunc_t, void *, const char_t *);
     os_timer_id_t (*timer_automatic)(pTimer_callbackFunc_t, void *, const char_t *);
+    os_timer_id_t (*timer_name_toId)(const char_t *);
     i32p_t (*timer_start)(os_timer_id_t, os_timer_ctrl_t, os_timeout_t);
+    i32p_t (*timer_start_us)(os_timer_id_t, os_timer_ctrl_t, u32_t);
+    i32p_t (*timer_service_set)(os_timer_id_t, u8_t);
+    i32p_t (*timer_catchup_set)(os_timer_id_t, os_timer_catchup_t, pTimer_missedCallbackFunc_t);
+    u32_t (*timer_overrun_get)(os_timer_id_t);
+    i32p_t (*timer_lateness_get)(os_timer_id_t, os_timer_lateness_t *);
+    i32p_t (*timer_system_lateness_get)(os_timer_lateness_t *);
+    i32p_t (*timer_slack_set)(os_timer_id_t, u32_t);
     i32p_t (*timer_stop)(os_timer_id_t);
     i32p_t (*timer_busy)(os_timer_id_t);
     i32p_t (*timer_delete)(os_timer_id_t);
     u32_t (*timer_system_total_ms)(void);
+    u64_t (*timer_system_total_us)(void);
     u32_t (*timer_system_busy_wait)(u32_t);
+    i32p_t (*timer_system_clock_set)(u32_t, pClock_switchFunc_t);
+    u32_t (*timer_system_clock_get)(void);
 
-    os_sem_id_t (*sem_init)(u8_t, u8_t, const char_t *);
+    os_sem_id_t (*sem_init)(u32_t, u32_t, const char_t *);
+    os_sem_id_t (*sem_name_toId)(const char_t *);
     i32p_t (*sem_take)(os_sem_id_t, os_timeout_t);
     i32p_t (*sem_give)(os_sem_id_t);
+    i32p_t (*sem_take_n)(os_sem_id_t, u32_t, os_timeout_t);
+    i32p_t (*sem_give_n)(os_sem_id_t, u32_t);
     i32p_t (*sem_flush)(os_sem_id_t);
+    i32p_t (*sem_wait_order_set)(os_sem_id_t, os_wait_order_t);
     i32p_t (*sem_delete)(os_sem_id_t);
 
     os_mutex_id_t (*mutex_init)(const char_t *);
+    os_mutex_id_t (*mutex_name_toId)(const char_t *);
     i32p_t (*mutex_lock)(os_mutex_id_t);
     i32p_t (*mutex_unlock)(os_mutex_id_t);
+    i32p_t (*mutex_cond_wait)(os_mutex_id_t, os_timeout_t);
+    i32p_t (*mutex_cond_signal)(os_mutex_id_t);
+    i32p_t (*mutex_cond_broadcast)(os_mutex_id_t);
+    i32p_t (*mutex_wait_order_set)(os_mutex_id_t, os_wait_order_t);
     i32p_t (*mutex_delete)(os_mutex_id_t);
 
-    os_evt_id_t (*evt_init)(u32_t, u32_t, u32_t, u32_t, const char_t *);
-    i32p_t (*evt_set)(os_evt_id_t, u32_t, u32_t, u32_t);
-    i32p_t (*evt_wait)(os_evt_id_t, os_evt_val_t *, u32_t, os_timeout_t);
+    os_rwlock_id_t (*rwlock_init)(b_t, const char_t *);
+    os_rwlock_id_t (*rwlock_name_toId)(const char_t *);
+    i32p_t (*rwlock_read_lock)(os_rwlock_id_t, os_timeout_t);
+    i32p_t (*rwlock_write_lock)(os_rwlock_id_t, os_timeout_t);
+    i32p_t (*rwlock_unlock)(os_rwlock_id_t);
+    i32p_t (*rwlock_delete)(os_rwlock_id_t);
+
+    os_evt_id_t (*evt_init)(u64_t, u64_t, u64_t, u64_t, const char_t *);
+    os_evt_id_t (*evt_name_toId)(const char_t *);
+    i32p_t (*evt_set)(os_evt_id_t, u64_t, u64_t, u64_t);
+    i32p_t (*evt_wait)(os_evt_id_t, os_evt_val_t *, u64_t, os_timeout_t);
+    i32p_t (*evt_wait_option)(os_evt_id_t, os_evt_val_t *, u64_t, os_evt_wait_opt_t, os_timeout_t);
+    i32p_t (*evt_wait_order_set)(os_evt_id_t, os_wait_order_t);
     i32p_t (*evt_delete)(os_evt_id_t);
 
     os_msgq_id_t (*msgq_init)(const void *, u16_t, u16_t, const char_t *);
+    os_msgq_id_t (*msgq_name_toId)(const char_t *);
     i32p_t (*msgq_put)(os_msgq_id_t, const u8_t *, u16_t, b_t, os_timeout_t);
     i32p_t (*msgq_get)(os_msgq_id_t, const u8_t *, u16_t, b_t, os_timeout_t);
+    i32p_t (*msgq_wait_order_set)(os_msgq_id_t, os_wait_order_t);
     i32p_t (*msgq_delete)(os_msgq_id_t);
     u32_t (*msgq_num_probe)(os_msgq_id_t);
 
     os_pool_id_t (*pool_init)(const void *, u16_t, u16_t, const char_t *);
+    os_pool_id_t (*pool_name_toId)(const char_t *);
     i32p_t (*pool_take)(os_pool_id_t, void **, u16_t, os_timeout_t);
     i32p_t (*pool_release)(os_pool_id_t, void **);
+    i32p_t (*pool_wait_order_set)(os_pool_id_t, os_wait_order_t);
     i32p_t (*pool_delete)(os_pool_id_t);
 
     os_publish_id_t (*publish_init)(const char_t *);
+    os_publish_id_t (*publish_name_toId)(const char_t *);
     i32p_t (*publish_data_submit)(os_publish_id_t, const void *, u16_t);
     os_subscribe_id_t (*subscribe_init)(void *, u16_t, const char_t *);
+    os_subscribe_id_t (*subscribe_name_toId)(const char_t *);
     i32p_t (*subscribe_register)(os_subscribe_id_t, os_publish_id_t, b_t, pSubscribe_callbackFunc_t);
     i32p_t (*subscribe_data_apply)(os_subscribe_id_t, void *, u16_t *);
     b_t (*subscribe_data_is_ready)(os_subscribe_id_t);
@@ -1310,6 +2418,13 @@ typedef struct {
     b_t (*schedule_is_running)(void);
     void (*schedule_lock)(void);
     void (*schedule_unlock)(void);
+    i32p_t (*transaction_init)(os_transaction_t *);
+    i32p_t (*transaction_sem_give)(os_transaction_t *, os_sem_id_t);
+    i32p_t (*transaction_evt_set)(os_transaction_t *, os_evt_id_t, u64_t, u64_t, u64_t);
+    i32p_t (*transaction_msgq_put)(os_transaction_t *, os_msgq_id_t, const u8_t *, u16_t, b_t);
+    i32p_t (*transaction_commit)(os_transaction_t *);
+    i32p_t (*transaction_result)(os_transaction_t *, u8_t);
+    i32p_t (*switch_hook_register)(pSwitch_hookFunc_t, pSwitch_hookFunc_t);
 
     void (*trace_versison)(void);
     void (*trace_postcode_fn_register)(const pTrace_postcodeFunc_t);
@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#ifndef _K_CLOCK_RECIPROCAL_H_
+#define _K_CLOCK_RECIPROCAL_H_
+
+#include "type_def.h"
+
+/**
+ * Data structure for the fix-point reciprocal of a divisor.
+ */
+typedef struct {
+    /* The multiplier rounded up of 2^shift / divisor, it needs 33 bits when the divisor is power of 2 */
+    _u64_t multiplier;
+
+    /* The shift value is 32 plus the floor log2 of the divisor */
+    _u8_t shift;
+} clock_reciprocal_t;
+
+/**
+ * @brief Precompute the multiply-shift reciprocal of the divisor, it's invoked at init or the clock change.
+ *
+ * @param pRecip The pointer of the reciprocal.
+ * @param divisor The divisor, it must not be zero.
+ */
+static inline void clock_reciprocal_init(clock_reciprocal_t *pRecip, _u32_t divisor)
+{
+    _u8_t log2 = 0u;
+
+    while (divisor >> (log2 + 1u)) {
+        log2++;
+    }
+
+    pRecip->shift = (_u8_t)(U32_B + log2);
+    pRecip->multiplier = ((((_u64_t)1u) << pRecip->shift) + divisor - 1u) / divisor;
+}
+
+/**
+ * @brief Divide the value by the reciprocal without the division instruction.
+ *
+ * The rounding error of the multiplier is less than the divisor, so the result is exact
+ * for all values below 2^31, it covers the full 24-bit clock reload range.
+ *
+ * @param pRecip The pointer of the reciprocal.
+ * @param value The dividend value.
+ *
+ * @return The value of the quotient.
+ */
+static inline _u32_t clock_reciprocal_divide(const clock_reciprocal_t *pRecip, _u32_t value)
+{
+    return (_u32_t)(((_u64_t)value * pRecip->multiplier) >> pRecip->shift);
+}
+
+#endif /* _K_CLOCK_RECIPROCAL_H_ */
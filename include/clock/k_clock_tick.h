@@ -8,6 +8,7 @@
 #define _K_CLOCK_TICK_H_
 
 #include "type_def.h"
+#include "k_struct.h"
 
 /**
  * Function pointer structure for the clock tells how much time has passed.
@@ -20,7 +21,11 @@ typedef void (*time_report_handler_t)(_u32_t);
 void clock_isr(void);
 void clock_time_interval_set(_u32_t interval_us);
 _u32_t clock_time_elapsed_get(void);
-_u32_t clock_time_get(void);
+_u64_t clock_time_get(void);
+void clock_time_rate_set(_u32_t mhz, pClock_switchFunc_t pSwitchFunc);
+_b_t clock_time_rate_isValid(_u32_t mhz);
+_u32_t clock_time_rate_get(void);
+_u32_t clock_time_clamped_get(void);
 _b_t clock_time_isDisabled(void);
 void clock_time_enable(void);
 void clock_time_disable(void);
@@ -30,6 +30,22 @@
 #define MUTEX_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
 
+#ifndef RWLOCK_RUNTIME_NUMBER_SUPPORTED
+#define RWLOCK_RUNTIME_NUMBER_SUPPORTED (1u)
+#endif
+
+#ifndef RWLOCK_READER_NUMBER_SUPPORTED
+#define RWLOCK_READER_NUMBER_SUPPORTED (4u)
+#endif
+
+#ifndef EVENT_WAITER_INDEX_NUMBER
+#define EVENT_WAITER_INDEX_NUMBER (8u)
+#endif
+
+#if (EVENT_WAITER_INDEX_NUMBER > 8u)
+#error "The event bit index records up to 8 waiters"
+#endif
+
 #ifndef QUEUE_RUNTIME_NUMBER_SUPPORTED
 #define QUEUE_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
@@ -38,6 +54,42 @@
 #define TIMER_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
 
+#ifndef TIMER_SERVICE_NUMBER_SUPPORTED
+#define TIMER_SERVICE_NUMBER_SUPPORTED (1u)
+#endif
+
+#ifndef IDLE_STATE_NUMBER_SUPPORTED
+#define IDLE_STATE_NUMBER_SUPPORTED (4u)
+#endif
+
+#ifndef TRANSACTION_OPERATION_NUMBER_SUPPORTED
+#define TRANSACTION_OPERATION_NUMBER_SUPPORTED (4u)
+#endif
+
+#ifndef STACKLESS_TASK_ENABLED
+#define STACKLESS_TASK_ENABLED (0)
+#endif
+
+#ifndef STACKLESS_RUNNER_STACK_SIZE
+#define STACKLESS_RUNNER_STACK_SIZE (1024u)
+#endif
+
+#ifndef STACKLESS_RUNNER_PRIORITY
+#define STACKLESS_RUNNER_PRIORITY (OS_PRIORITY_APPLICATION_LOWEST_LEVEL)
+#endif
+
+#ifndef SWITCH_HOOK_DYNAMIC_ENABLED
+#define SWITCH_HOOK_DYNAMIC_ENABLED (0)
+#endif
+
+#ifndef THREAD_TLS_SLOT_NUMBER
+#define THREAD_TLS_SLOT_NUMBER (4u)
+#endif
+
+#ifndef NAME_HASH_BUCKET_NUMBER
+#define NAME_HASH_BUCKET_NUMBER (16u)
+#endif
+
 #ifndef POOL_RUNTIME_NUMBER_SUPPORTED
 #define POOL_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
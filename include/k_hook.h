@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#ifndef _K_HOOK_H_
+#define _K_HOOK_H_
+
+#include "type_def.h"
+#include "k_struct.h"
+#include "k_config.h"
+
+/**
+ * The static hooks are configured by the function name in the os_config.h, and they're compiled to the direct calls.
+ * For example: #define SWITCH_OUT_HOOK_STATIC app_mpu_switch_out
+ */
+#if defined(SWITCH_OUT_HOOK_STATIC)
+extern void SWITCH_OUT_HOOK_STATIC(_u32_t id);
+#define _SWITCH_OUT_HOOK_STATIC_INVOKE(out) SWITCH_OUT_HOOK_STATIC(out)
+#else
+#define _SWITCH_OUT_HOOK_STATIC_INVOKE(out)
+#endif
+
+#if defined(SWITCH_IN_HOOK_STATIC)
+extern void SWITCH_IN_HOOK_STATIC(_u32_t id);
+#define _SWITCH_IN_HOOK_STATIC_INVOKE(in) SWITCH_IN_HOOK_STATIC(in)
+#else
+#define _SWITCH_IN_HOOK_STATIC_INVOKE(in)
+#endif
+
+#if (SWITCH_HOOK_DYNAMIC_ENABLED)
+static inline void kernel_switch_hook_dynamic_invoke(pSwitch_hookFunc_t pHookFunc, _u32_t id)
+{
+    if (pHookFunc) {
+        pHookFunc(id);
+    }
+}
+#define _SWITCH_OUT_HOOK_DYNAMIC_INVOKE(pHook, out) kernel_switch_hook_dynamic_invoke((pHook)->pOutFunc, out)
+#define _SWITCH_IN_HOOK_DYNAMIC_INVOKE(pHook, in)   kernel_switch_hook_dynamic_invoke((pHook)->pInFunc, in)
+#else
+#define _SWITCH_OUT_HOOK_DYNAMIC_INVOKE(pHook, out)
+#define _SWITCH_IN_HOOK_DYNAMIC_INVOKE(pHook, in)
+#endif
+
+#if (!defined(SWITCH_OUT_HOOK_STATIC)) && (!defined(SWITCH_IN_HOOK_STATIC)) && (!SWITCH_HOOK_DYNAMIC_ENABLED)
+/* The hook-free build, the switch path has no added instruction */
+#define SWITCH_HOOK_NONE (1)
+#else
+#define SWITCH_HOOK_NONE (0)
+#endif
+
+/**
+ * @brief Invoke the context switch hooks, the switch-out hooks run before the switch-in hooks.
+ *
+ * The arguments are not evaluated in the hook-free build.
+ *
+ * @param pHook The pointer of the runtime registered hooks.
+ * @param out The switching out thread id.
+ * @param in The switching in thread id.
+ */
+#define KERNEL_SWITCH_HOOK_INVOKE(pHook, out, in)                                                                                          \
+    do {                                                                                                                                   \
+        _SWITCH_OUT_HOOK_STATIC_INVOKE(out);                                                                                               \
+        _SWITCH_OUT_HOOK_DYNAMIC_INVOKE(pHook, out);                                                                                       \
+        _SWITCH_IN_HOOK_DYNAMIC_INVOKE(pHook, in);                                                                                         \
+        _SWITCH_IN_HOOK_STATIC_INVOKE(in);                                                                                                 \
+    } while (0)
+
+#endif /* _K_HOOK_H_ */
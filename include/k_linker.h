@@ -39,6 +39,16 @@ struct list {
 };
 typedef struct list list_t;
 
+/** @brief singly linked fifo structure, the tail pointer allows the O(1) push. */
+struct list_fifo {
+    /* The pointer of the node head. */
+    struct list_node *pHead;
+
+    /* The pointer of the node tail. */
+    struct list_node *pTail;
+};
+typedef struct list_fifo list_fifo_t;
+
 /** @brief the direction of node operation structure. */
 typedef enum {
     LIST_HEAD,
@@ -87,6 +97,9 @@ _b_t list_node_delete(list_t *pList, list_node_t *pTargetNode);
 _b_t list_node_insertBefore(list_t *pList, list_node_t *pBefore, list_node_t *pTargetNode);
 _b_t list_node_push(list_t *pList, list_node_t *pInNode, list_direction_t direction);
 list_node_t *list_node_pop(list_t *pList, list_direction_t direction);
+_b_t list_fifo_push(list_fifo_t *pFifo, list_node_t *pInNode);
+list_node_t *list_fifo_pop(list_fifo_t *pFifo);
+_b_t list_fifo_remove(list_fifo_t *pFifo, list_node_t *pTargetNode);
 _b_t list_iterator_init(list_iterator_t *pIterator, list_t *pList);
 _b_t list_iterator_next_condition(list_iterator_t *pIterator, list_node_t **ppOutNode);
 list_node_t *list_iterator_next(list_iterator_t *pIterator);
@@ -24,17 +24,54 @@
 
 typedef void (*pCallbackFunc_t)(void);
 typedef void (*pTimer_callbackFunc_t)(void *);
+typedef void (*pTimer_missedCallbackFunc_t)(void *, _u32_t);
 typedef void (*pTask_callbackFunc_t)(void *);
 typedef void (*pThread_entryFunc_t)(void *);
 typedef void (*pEvent_callbackFunc_t)(void);
 typedef void (*pSubscribe_callbackFunc_t)(const void *, _u16_t);
 typedef void (*pTimeout_callbackFunc_t)(void *);
 typedef void (*pNotify_callbackFunc_t)(void *);
+typedef _u32_t (*pIdle_enterFunc_t)(_u32_t);
+typedef void (*pClock_switchFunc_t)(_u32_t);
+typedef void (*pSwitch_hookFunc_t)(_u32_t);
 
 struct base_head {
     _u8_t cs; // control and status
 
     const _char_t *pName;
+
+    struct base_head *pHashNext; // next object in the same name hash bucket
+};
+
+struct switch_hook {
+    pSwitch_hookFunc_t pOutFunc;
+
+    pSwitch_hookFunc_t pInFunc;
+};
+
+struct wait_queue;
+typedef void (*pQueue_refreshFunc_t)(struct wait_queue *);
+
+struct wait_queue {
+    /* The blocking threads list, the head is the next one to wake up */
+    list_t list;
+
+    /* The cached tail node for the constant time append, it's verified before using */
+    list_node_t *pTail;
+
+    /* The waiting order, the priority or the arrival order */
+    _u8_t order;
+
+    /* It re-checks the blocking threads after one left by the timeout or suspension, or was repositioned */
+    pQueue_refreshFunc_t pRefreshFunc;
+};
+typedef struct wait_queue wait_queue_t;
+
+struct lock_hold {
+    list_node_t node;
+
+    /* The wait queues of the threads blocking on the lock, the holder inherits their highest priority */
+    wait_queue_t *pQueue[2];
 };
 
 struct publish_context {
@@ -62,6 +99,8 @@ struct subscribe_callback {
     list_node_t node;
 
     pSubscribe_callbackFunc_t pSubCallEntry;
+
+    _b_t queued;
 };
 
 typedef struct {
@@ -81,15 +120,36 @@ struct expired_time {
 
     _u64_t duration_us;
 
+    _u32_t slack_us;
+
     pTimeout_callbackFunc_t fn;
 };
 
+struct timer_lateness {
+    /* The log2 buckets of the lateness, the bucket n counts the lateness in [2^(n-1), 2^n) us, the bucket 0 is on time */
+    _u32_t bucket[TIMER_LATENESS_BUCKET_NUMBER];
+
+    /* The maximum lateness */
+    _u32_t max_us;
+
+    /* The number of the clock interval clamped to the hardware limitation */
+    _u32_t clamped;
+};
+
 struct timer_callback {
     list_node_t node;
 
     void *pUserData;
 
     pTimer_callbackFunc_t pTimerCallEntry;
+
+    pTimer_missedCallbackFunc_t pTimerMissedEntry;
+
+    /* The number of the callback invoking pending in the kernel thread */
+    _u32_t pending;
+
+    /* The number of the missed periods to be reported by the coalesced callback */
+    _u32_t missed;
 };
 
 typedef struct {
@@ -97,7 +157,19 @@ typedef struct {
 
     _u8_t control;
 
-    _u32_t timeout_ms;
+    _u8_t catchup;
+
+    _u8_t service;
+
+    _u64_t timeout_us;
+
+    /* The absolute deadline of the next expiry based on the system time */
+    _u64_t deadline_us;
+
+    /* The total number of the missed periods */
+    _u32_t overrun;
+
+    struct timer_lateness lateness;
 
     struct expired_time expire;
 
@@ -107,13 +179,13 @@ typedef struct {
 typedef struct {
     struct base_head head;
 
-    _u8_t remains;
+    _u32_t remains;
 
-    _u8_t limits;
+    _u32_t limits;
 
     _u32_t timeout_ms;
 
-    list_t q_list;
+    wait_queue_t q_list;
 } semaphore_context_t;
 
 typedef struct {
@@ -123,11 +195,44 @@ typedef struct {
 
     struct schedule_task *pHoldTask;
 
-    _i16_t originalPriority;
+    /* It's linked into the hold list of the holder */
+    struct lock_hold hold;
 
-    list_t q_list;
+    wait_queue_t q_list;
+
+    wait_queue_t cond_QList;
 } mutex_context_t;
 
+struct rwlock_reader {
+    struct schedule_task *pTask;
+
+    /* The number of read locks held by the thread */
+    _u16_t count;
+};
+
+typedef struct {
+    struct base_head head;
+
+    /* The new readers wait behind the blocking writers when it's true */
+    _b_t writerPrefer;
+
+    /* The number of read locks held by the readers */
+    _u16_t readers;
+
+    /* The writer holding the lock */
+    struct schedule_task *pWriteTask;
+
+    /* It's linked into the hold list of the writer */
+    struct lock_hold hold;
+
+    /* The reader threads holding the lock, it's checked when the read lock is released */
+    struct rwlock_reader reader[RWLOCK_READER_NUMBER_SUPPORTED];
+
+    wait_queue_t r_QList;
+
+    wait_queue_t w_QList;
+} rwlock_context_t;
+
 typedef struct {
     const _u8_t *pUsrBuf;
     _u16_t size;
@@ -149,9 +254,9 @@ typedef struct {
 
     _u16_t cacheSize;
 
-    list_t in_QList;
+    wait_queue_t in_QList;
 
-    list_t out_QList;
+    wait_queue_t out_QList;
 } queue_context_t;
 
 typedef struct {
@@ -165,12 +270,18 @@ typedef struct {
 
     _u32_t elementFreeBits;
 
-    list_t q_list;
+    wait_queue_t q_list;
 } pool_context_t;
 
 typedef struct {
     /* The listen bits*/
-    _u32_t listen;
+    _u64_t listen;
+
+    /* Wait any listen bits = 0, Wait all listen bits = 1 */
+    _u8_t option;
+
+    /* The waiter index slot */
+    _u8_t slot;
 
     struct evt_val *pEvtVal;
 } event_sch_t;
@@ -185,28 +296,94 @@ typedef struct {
     struct base_head head;
 
     /* The event signal value */
-    _u32_t value;
+    _u64_t value;
 
     /* Changed bits always trigger = 1, See dirMask below = 0. */
-    _u32_t anyMask;
+    _u64_t anyMask;
 
     /* Level trigger = 0, Edge trigger = 1. */
-    _u32_t modeMask;
+    _u64_t modeMask;
 
     /* Fall or Low trigger = 0, Rise or high trigger = 1. */
-    _u32_t dirMask;
+    _u64_t dirMask;
 
     /* The triggered value */
-    _u32_t triggered;
+    _u64_t triggered;
 
     /* When the event change that meet with edge setting, the function will be called */
     struct event_callback call;
 
-    list_t q_list;
+    /* The blocking waiters recorded in the bit index */
+    struct schedule_task *pWaiter[EVENT_WAITER_INDEX_NUMBER];
+
+    /* Each bit records the waiter slots listening to it */
+    _u8_t bitIndex[EVENT_BITS_NUMBER];
+
+    /* The number of the blocking waiters out of the bit index */
+    _u8_t unindexed;
+
+    wait_queue_t q_list;
 } event_context_t;
 
+struct idle_state {
+    const _char_t *pName;
+
+    /* The entry and exit latency of the low power state */
+    _u32_t latency_us;
+
+    /* The minimum residency to pay back the entry and exit cost */
+    _u32_t residency_us;
+
+    /**
+     * It enters the low power state with the predicted sleep time, and returns the sleep time which the clock didn't count.
+     * It's called in the kernel privilege routine with the interrupts masked, the core wakes up by the interrupt pending event.
+     */
+    pIdle_enterFunc_t pEnterFn;
+};
+
+struct idle_residency {
+    /* The number of the state entered */
+    _u32_t count;
+
+    /* The total time spent in the state */
+    _u64_t total_us;
+};
+
+struct transaction_operation {
+    /* The kernel operation type */
+    _u8_t type;
+
+    /* The kernel object context */
+    _u32_t ctx;
+
+    /* The operation arguments copied when it's recorded */
+    union {
+        struct {
+            _u64_t set;
+            _u64_t clear;
+            _u64_t toggle;
+        } evt;
+
+        struct {
+            const _u8_t *pUserBuffer;
+            _u16_t size;
+            _b_t isToFront;
+        } msgq;
+    } arg;
+
+    /* The operation result after the transaction commit */
+    _i32p_t result;
+};
+
+struct kernel_transaction {
+    /* The number of the recorded operations */
+    _u8_t number;
+
+    struct transaction_operation operation[TRANSACTION_OPERATION_NUMBER_SUPPORTED];
+};
+
 struct call_exit {
-    list_t *pToList;
+    wait_queue_t *pToQueue;
 
     _u32_t timeout_ms;
 };
@@ -225,6 +402,8 @@ struct call_analyze {
     _u32_t last_run_ms;
 
     _u32_t total_run_ms;
+
+    _u32_t fpu_switch;
 };
 
 struct call_exec {
@@ -242,8 +421,17 @@ struct schedule_task {
 
     _u32_t psp;
 
+    /* The effective priority, it's raised above the base priority by the priority inheritance */
     _i16_t prior;
 
+    /* The assigned priority */
+    _i16_t basePrior;
+
+    /* The locks it holds, the inherited priority is recomputed from their blocking threads */
+    list_t holdList;
+
+    _u8_t stackless;
+
     void *pPendCtx;
 
     void *pPendData;
@@ -264,6 +452,8 @@ struct thread_context {
 
     void *pUserData;
 
+    void *tls[THREAD_TLS_SLOT_NUMBER];
+
     struct schedule_task task;
 };
 typedef struct thread_context thread_context_t;
@@ -273,6 +463,36 @@ typedef struct {
     void *p_arg;
 } thread_context_init_t;
 
+struct stackless_task;
+typedef _u8_t (*pStackless_entryFunc_t)(struct stackless_task *, void *);
+
+struct stackless_pend {
+    union {
+        _u32_t count;
+
+        queue_sch_t que;
+
+        event_sch_t evt;
+    } data;
+};
+
+struct stackless_task {
+    struct schedule_task task;
+
+    pStackless_entryFunc_t pEntryFunc;
+
+    void *pArg;
+
+    /* The local continuation, it's the resume point of the entry function */
+    _u16_t lc;
+
+    _i32p_t result;
+
+    /* The waiting data has to keep alive after the entry function returns at a wait point */
+    struct stackless_pend pend;
+};
+typedef struct stackless_task stackless_task_t;
+
 /** @brief The rtos kernel structure. */
 typedef struct {
     struct schedule_task *pTask;
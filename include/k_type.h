@@ -19,6 +19,13 @@
 #define OS_TIME_INVALID_VAL (0xFFFFFFFFu)
 #define OS_TIME_FOREVER_VAL (0xFFFFFFFEu)
 #define OS_TIME_NOWAIT_VAL  (0x0u)
+#define OS_TIME_US_FLAG_VAL (0x80000000u)
+#define OS_TIME_US_MASK_VAL (0x7FFFFFFFu)
+#define OS_TIME_US_MAX_VAL  (0x7FFFFFFDu)
+
+/* The microsecond timeout is clamped below the OS_TIME_FOREVER_VAL and OS_TIME_INVALID_VAL */
+#define OS_TIME_US_ENCODE(us)                                                                                                              \
+    (OS_TIME_US_FLAG_VAL | (((_u64_t)(us) > OS_TIME_US_MAX_VAL) ? (OS_TIME_US_MAX_VAL) : ((_u32_t)(us))))
 
 #define OS_PRIOTITY_NUM             (256)
 #define OS_PRIOTITY_PREEMPT_NUM     (OS_PRIOTITY_NUM - 1)
@@ -33,10 +40,38 @@
 #define OS_PRIORITY_APPLICATION_HIGHEST_LEVEL (OS_PRIOTITY_HIGHEST_LEVEL + 1)
 #define OS_PRIORITY_APPLICATION_LOWEST_LEVEL  (OS_PRIOTITY_LOWEST_LEVEL - 1)
 
+#define STACKLESS_STATE_YIELD_VAL (0u)
+#define STACKLESS_STATE_WAIT_VAL  (1u)
+#define STACKLESS_STATE_EXIT_VAL  (2u)
+
 #define TIMER_CTRL_ONCE_VAL      (0u)
 #define TIMER_CTRL_CYCLE_VAL     (1u)
 #define TIMER_CTRL_TEMPORARY_VAL (2u)
 
+#define TIMER_CATCHUP_SKIP_VAL     (0u)
+#define TIMER_CATCHUP_BURST_VAL    (1u)
+#define TIMER_CATCHUP_COALESCE_VAL (2u)
+
+#define TIMER_LATENESS_BUCKET_NUMBER (16u)
+
+#define TIMER_SERVICE_KERNEL_VAL (0u)
+#define TIMER_SERVICE_HARD_VAL   (0xFFu)
+
+#define WAIT_ORDER_PRIORITY_VAL (0u)
+#define WAIT_ORDER_FIFO_VAL     (1u)
+
+#define TRANSACTION_OPER_SEM_GIVE_VAL (0u)
+#define TRANSACTION_OPER_EVT_SET_VAL  (1u)
+#define TRANSACTION_OPER_MSGQ_PUT_VAL (2u)
+#define TRANSACTION_OPER_NUMBER       (3u)
+
+#define EVENT_WAIT_ANY_VAL (0u)
+#define EVENT_WAIT_ALL_VAL (1u)
+
+#define EVENT_BITS_NUMBER      (64u)
+#define EVENT_WAITER_UNINDEXED (0xFFu)
+#define EVENT_WAITER_RELEASED  (0xFEu)
+
 enum {
     PC_OS_OK = 0,
     PC_OS_WAIT_TIMEOUT,
@@ -63,8 +98,8 @@ struct os_id {
 };
 
 struct evt_val {
-    _u32_t value;
-    _u32_t trigger;
+    _u64_t value;
+    _u64_t trigger;
 };
 
 /* End of section using anonymous unions */
@@ -311,6 +311,8 @@ _b_t port_isInThreadMode(void);
 _u32_t port_irq_disable(void);
 void port_irq_enable(_u32_t value);
 void port_setPendSV(void);
+void port_wait_for_interrupt(void);
+_b_t port_fpu_context_isActive(_u32_t exc_return);
 void port_interrupt_init(void);
 _u32_t port_stack_frame_init(void (*pEntryFn)(void *), _u32_t *pAddress, _u32_t size, void *pArg);
 _u32_t port_stack_free_size_get(_u32_t stack_addr);
@@ -20,6 +20,9 @@ enum {
     PC_OS_CMPT_TIMER_8,
     PC_OS_CMPT_POOL_9,
     PC_OS_CMPT_PUBLISH_10,
+    PC_OS_CMPT_RWLOCK_11,
+    PC_OS_CMPT_IDLE_12,
+    PC_OS_CMPT_STACKLESS_13,
 
     PC_OS_COMPONENT_NUMBER,
 };
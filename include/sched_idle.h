@@ -0,0 +1,14 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#ifndef _SCHED_IDLE_H_
+#define _SCHED_IDLE_H_
+
+#include "k_struct.h"
+
+void idle_governor_run(void);
+
+#endif /* _SCHED_IDLE_H_ */
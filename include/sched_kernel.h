@@ -37,25 +37,39 @@ void impl_kernel_irq_enable(_u32_t val);
          impl_kernel_irq_enable(__item.u32_val), __item.i++)
 
 thread_context_t *kernel_thread_runContextGet(void);
+void **kernel_thread_tlsGet(void);
+struct schedule_task *kernel_task_runGet(void);
+struct stackless_task *kernel_stackless_runGet(void);
+void kernel_stackless_runSet(struct stackless_task *pStackless);
 list_t *kernel_member_list_get(_u8_t member_id, _u8_t list_id);
 void kernel_thread_list_transfer_toEntry(linker_head_t *pCurHead);
-_i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, list_t *pToList, _u32_t timeout_ms,
+_i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, wait_queue_t *pToQueue, _u32_t timeout_ms,
                               _b_t immediately);
 _i32p_t schedule_entry_trigger(struct schedule_task *pTask, pTask_callbackFunc_t callback, _u32_t result);
+void schedule_entry_redirect(struct schedule_task *pTask, void *pHoldCtx, wait_queue_t *pToQueue);
+void schedule_priority_set(struct schedule_task *pTask, _i16_t prior);
+void schedule_priority_recover(struct schedule_task *pTask);
+void schedule_lock_hold(struct schedule_task *pTask, struct lock_hold *pHold);
+void schedule_lock_release(struct schedule_task *pTask, struct lock_hold *pHold);
 void schedule_callback_fromTimeOut(void *pNode);
 void schedule_setPend(struct schedule_task *pTask);
-list_t *schedule_waitList(void);
+wait_queue_t *schedule_waitList(void);
+_b_t schedule_wait_order_set(wait_queue_t *pQueue, _u8_t order);
+void schedule_stackless_runner_set(struct schedule_task *pRunner);
+void schedule_stackless_ready(struct schedule_task *pTask);
+struct stackless_task *schedule_stackless_take(void);
 _b_t schedule_hasTwoPendingItem(void);
 _i32p_t kernel_schedule_result_take(void);
 _u32_t kernel_stack_frame_init(void (*pEntryFn)(void *), _u32_t *pAddress, _u32_t size, void *p_arg);
 _b_t kernel_isInThreadMode(void);
 _i32p_t kernel_thread_schedule_request(void);
 void kernel_message_notification(void);
-void kernel_scheduler_inPendSV_c(_u32_t **ppCurPsp, _u32_t **ppNextPSP);
+void kernel_scheduler_inPendSV_c(_u32_t **ppCurPsp, _u32_t **ppNextPSP, _u32_t exc_return);
 void kernel_privilege_call_inSVC_c(_u32_t *svc_args);
 _i32p_t kernel_privilege_invoke(const void *pCallFun, arguments_t *pArgs);
 void kernel_schedule_thread(void *p_arg);
 void kernel_idle_thread(void *p_arg);
+void kernel_stackless_thread(void *p_arg);
 void kthread_message_notification(void);
 _i32p_t kthread_message_arrived(void);
 void kthread_message_idle_loop_fn(void);
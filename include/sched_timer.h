@@ -13,7 +13,10 @@ void timeout_set(struct expired_time *pExpire, _u32_t timeout_ms, _b_t immediate
 void timeout_remove(struct expired_time *pExpire, _b_t immediately);
 _u32_t timer_total_system_ms_get(void);
 _u32_t timer_total_system_us_get(void);
+_u64_t timer_total_system_us64_get(void);
 _i32p_t timer_schedule(void);
+_u32_t timer_next_expiry_us_get(void);
+void timer_sleep_compensate(_u32_t sleep_us);
 void timer_reamining_elapsed_handler(void);
 void timeout_handler(_u32_t elapsed_us);
 void timeout_init(struct expired_time *pExpire, pTimeout_callbackFunc_t fun);
@@ -18,6 +18,7 @@
 #define INIT_SECTION_OS_TIMER_LIST _INIT_OS_TIMER_LIST
 #define INIT_SECTION_OS_SEMAPHORE_LIST _INIT_OS_SEMAPHORE_LIST
 #define INIT_SECTION_OS_MUTEX_LIST _INIT_OS_MUTEX_LIST
+#define INIT_SECTION_OS_RWLOCK_LIST _INIT_OS_RWLOCK_LIST
 #define INIT_SECTION_OS_EVENT_LIST  _INIT_OS_EVENT_LIST
 #define INIT_SECTION_OS_QUEUE_LIST _INIT_OS_QUEUE_LIST
 #define INIT_SECTION_OS_POOL_LIST  _INIT_OS_POOL_LIST
@@ -41,6 +42,9 @@
 #define INIT_SECTION_OS_MUTEX_LIST "_INIT_OS_MUTEX_LIST"
 #pragma section = INIT_SECTION_OS_MUTEX_LIST
 
+#define INIT_SECTION_OS_RWLOCK_LIST "_INIT_OS_RWLOCK_LIST"
+#pragma section = INIT_SECTION_OS_RWLOCK_LIST
+
 #define INIT_SECTION_OS_EVENT_LIST  "_INIT_OS_EVENT_LIST"
 #pragma section = INIT_SECTION_OS_EVENT_LIST
 
@@ -67,6 +71,7 @@
 #define INIT_OS_TIMER_ID(x)  struct os_id x = {.p_val = (void*)&_init_##x##_timer, .pName = #x}
 #define INIT_OS_SEM_ID(x)    struct os_id x = {.p_val = (void*)&_init_##x##_sem, .pName = #x}
 #define INIT_OS_MUTEX_ID(x)  struct os_id x = {.p_val = (void*)&_init_##x##_mutex, .pName = #x}
+#define INIT_OS_RWLOCK_ID(x) struct os_id x = {.p_val = (void*)&_init_##x##_rwlock, .pName = #x}
 #define INIT_OS_EVT_ID(x)    struct os_id x = {.p_val = (void*)&_init_##x##_evt, .pName = #x}
 #define INIT_OS_MSGQ_ID(x)   struct os_id x = {.p_val = (void*)&_init_##x##_msgq, .pName = #x}
 #define INIT_OS_POOL_ID(x)   struct os_id x = {.p_val = (void*)&_init_##x##_pool, .pName = #x}
@@ -77,6 +82,7 @@
 #define INIT_OS_TIMER_ID(x)  void* x = (void*)&_init_##x##_timer
 #define INIT_OS_SEM_ID(x)    void* x = (void*)&_init_##x##_sem
 #define INIT_OS_MUTEX_ID(x)  void* x = (void*)&_init_##x##_mutex
+#define INIT_OS_RWLOCK_ID(x) void* x = (void*)&_init_##x##_rwlock
 #define INIT_OS_EVT_ID(x)    void* x = (void*)&_init_##x##_evt
 #define INIT_OS_MSGQ_ID(x)   void* x = (void*)&_init_##x##_msgq
 #define INIT_OS_POOL_ID(x)   void* x = (void*)&_init_##x##_pool
@@ -103,7 +109,7 @@
          .pStackAddr = id_name##_stack,                                                                                                    \
          .stackSize = stack_size,                                                                                                          \
          .pEntryFunc = pEntryFn,                                                                                                           \
-         .task = {.prior = priority, .psp = 0u}};                                                                                          \
+         .task = {.prior = priority, .basePrior = priority, .psp = 0u}};                                                                   \
     INIT_USED thread_context_init_t _init_##id_name##_thread_init INIT_SECTION(_INIT_OS_THREAD_STATIC) =                                   \
         {.p_thread = &_init_##id_name##_thread, .p_arg = pArg};                                                                            \
     INIT_OS_THREAD_ID(id_name)
@@ -119,6 +125,10 @@ extern void timer_callback_fromTimeOut(void *pNode);
          .call = {.pTimerCallEntry = pEntryFunc}};                                                                                         \
     INIT_OS_TIMER_ID(id_name)
 
+extern void _impl_timer_service_thread(void *pArg);
+#define INIT_OS_TIMER_SERVICE_DEFINE(id_name, service, priority, stack_size)                                                               \
+    INIT_OS_THREAD_DEFINE(id_name, priority, stack_size, _impl_timer_service_thread, (void *)(service))
+
 #define INIT_OS_SEM_RUNTIME_NUM_DEFINE(num)                                                                                                \
     INIT_USED semaphore_context_t _init_runtime_sem[num] INIT_SECTION(_INIT_OS_SEMAPHORE_LIST) = {0}
 
@@ -126,7 +136,8 @@ extern void timer_callback_fromTimeOut(void *pNode);
     INIT_USED semaphore_context_t _init_##id_name##_sem INIT_SECTION(_INIT_OS_SEMAPHORE_LIST) =                                            \
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
          .remains = remain,                                                                                                                \
-         .limits = limit};                                                                                                                 \
+         .limits = limit,                                                                                                                  \
+         .q_list = {.pRefreshFunc = semaphore_queue_refresh}};                                                                             \
     INIT_OS_SEM_ID(id_name)
 
 #define INIT_OS_MUTEX_RUNTIME_NUM_DEFINE(num)                                                                                              \
@@ -136,10 +147,22 @@ extern void timer_callback_fromTimeOut(void *pNode);
     INIT_USED mutex_context_t _init_##id_name##_mutex INIT_SECTION(_INIT_OS_MUTEX_LIST) =                                                  \
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
          .locked = false,                                                                                                                  \
-         .pHoldTask = NULL,                                                                                                                \
-         .originalPriority = OS_PRIOTITY_INVALID_LEVEL};                                                                                   \
+         .pHoldTask = NULL};                                                                                                               \
     INIT_OS_MUTEX_ID(id_name)
 
+#define INIT_OS_RWLOCK_RUNTIME_NUM_DEFINE(num)                                                                                             \
+    INIT_USED rwlock_context_t _init_runtime_rwlock[num] INIT_SECTION(_INIT_OS_RWLOCK_LIST) = {0}
+
+#define INIT_OS_RWLOCK_DEFINE(id_name, prefer)                                                                                             \
+    INIT_USED rwlock_context_t _init_##id_name##_rwlock INIT_SECTION(_INIT_OS_RWLOCK_LIST) =                                               \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .writerPrefer = prefer,                                                                                                           \
+         .readers = 0u,                                                                                                                    \
+         .pWriteTask = NULL,                                                                                                               \
+         .r_QList = {.pRefreshFunc = rwlock_read_queue_refresh},                                                                           \
+         .w_QList = {.pRefreshFunc = rwlock_write_queue_refresh}};                                                                         \
+    INIT_OS_RWLOCK_ID(id_name)
+
 #define INIT_OS_EVT_RUNTIME_NUM_DEFINE(num)                                                                                                \
     INIT_USED event_context_t _init_runtime_evt[num] INIT_SECTION(_INIT_OS_EVENT_LIST) = {0}
 
@@ -150,7 +173,8 @@ extern void timer_callback_fromTimeOut(void *pNode);
          .triggered = 0u,                                                                                                                  \
          .anyMask = anyMask,                                                                                                               \
          .modeMask = modeMask,                                                                                                             \
-         .dirMask = dirMask};                                                                                                              \
+         .dirMask = dirMask,                                                                                                               \
+         .q_list = {.pRefreshFunc = event_queue_refresh}};                                                                                 \
     INIT_OS_EVT_ID(id_name)
 
 #define INIT_OS_MSGQ_RUNTIME_NUM_DEFINE(num)                                                                                               \
@@ -218,7 +242,7 @@ extern void subscribe_notification(void *pLinker);
          .pStackAddr = id_name##_stack,                                                                                                    \
          .stackSize = stack_size,                                                                                                          \
          .pEntryFunc = pEntryFn,                                                                                                           \
-         .task = {.prior = priority, .psp = 0u}};                                                                                          \
+         .task = {.prior = priority, .basePrior = priority, .psp = 0u}};                                                                   \
     static __root thread_context_init_t _init_##id_name##_thread_init @ "_INIT_OS_THREAD_STATIC" =                                         \
         {.p_thread = &_init_##id_name##_thread, .p_arg = pArg};                                                                            \
     INIT_OS_THREAD_ID(id_name)
@@ -234,6 +258,10 @@ extern void timer_callback_fromTimeOut(void *pNode);
          .call = {.pTimerCallEntry = pEntryFunc}};                                                                                         \
     INIT_OS_TIMER_ID(id_name)
 
+extern void _impl_timer_service_thread(void *pArg);
+#define INIT_OS_TIMER_SERVICE_DEFINE(id_name, service, priority, stack_size)                                                               \
+    INIT_OS_THREAD_DEFINE(id_name, priority, stack_size, _impl_timer_service_thread, (void *)(service))
+
 #define INIT_OS_SEM_RUNTIME_NUM_DEFINE(num)                                                                                                \
     static __root semaphore_context_t _init_runtime_sem[num] @ "_INIT_OS_SEMAPHORE_LIST" = {0}
 
@@ -241,7 +269,8 @@ extern void timer_callback_fromTimeOut(void *pNode);
     static __root semaphore_context_t _init_##id_name##_sem @ "_INIT_OS_SEMAPHORE_LIST" =                                                  \
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
          .remains = remain,                                                                                                                \
-         .limits = limit};                                                                                                                 \
+         .limits = limit,                                                                                                                  \
+         .q_list = {.pRefreshFunc = semaphore_queue_refresh}};                                                                             \
     INIT_OS_SEM_ID(id_name)
 
 #define INIT_OS_MUTEX_RUNTIME_NUM_DEFINE(num)                                                                                              \
@@ -251,10 +280,22 @@ extern void timer_callback_fromTimeOut(void *pNode);
     static __root mutex_context_t _init_##id_name##_mutex @ "_INIT_OS_MUTEX_LIST" =                                                        \
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
          .locked = false,                                                                                                                  \
-         .pHoldTask = NULL,                                                                                                                \
-         .originalPriority = OS_PRIOTITY_INVALID_LEVEL};                                                                                   \
+         .pHoldTask = NULL};                                                                                                               \
     INIT_OS_MUTEX_ID(id_name)
 
+#define INIT_OS_RWLOCK_RUNTIME_NUM_DEFINE(num)                                                                                             \
+    static __root rwlock_context_t _init_runtime_rwlock[num] @ "_INIT_OS_RWLOCK_LIST" = {0}
+
+#define INIT_OS_RWLOCK_DEFINE(id_name, prefer)                                                                                             \
+    static __root rwlock_context_t _init_##id_name##_rwlock @ "_INIT_OS_RWLOCK_LIST" =                                                     \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .writerPrefer = prefer,                                                                                                           \
+         .readers = 0u,                                                                                                                    \
+         .pWriteTask = NULL,                                                                                                               \
+         .r_QList = {.pRefreshFunc = rwlock_read_queue_refresh},                                                                           \
+         .w_QList = {.pRefreshFunc = rwlock_write_queue_refresh}};                                                                         \
+    INIT_OS_RWLOCK_ID(id_name)
+
 #define INIT_OS_EVT_RUNTIME_NUM_DEFINE(num)                                                                                                \
     static __root event_context_t _init_runtime_evt[num] @ "_INIT_OS_EVENT_LIST" = {0}
 
@@ -265,7 +306,8 @@ extern void timer_callback_fromTimeOut(void *pNode);
          .triggered = 0u,                                                                                                                  \
          .anyMask = anyMask,                                                                                                               \
          .modeMask = modeMask,                                                                                                             \
-         .dirMask = dirMask};                                                                                                              \
+         .dirMask = dirMask,                                                                                                               \
+         .q_list = {.pRefreshFunc = event_queue_refresh}};                                                                                 \
     INIT_OS_EVT_ID(id_name)
 
 #define INIT_OS_MSGQ_RUNTIME_NUM_DEFINE(num)                                                                                               \
@@ -367,6 +409,20 @@ enum {
     INIT_LEVEL_NUM,
 };
 
+enum {
+    INIT_SLOT_THREAD,
+    INIT_SLOT_TIMER,
+    INIT_SLOT_SEMAPHORE,
+    INIT_SLOT_MUTEX,
+    INIT_SLOT_RWLOCK,
+    INIT_SLOT_EVENT,
+    INIT_SLOT_QUEUE,
+    INIT_SLOT_POOL,
+    INIT_SLOT_PUBLISH,
+    INIT_SLOT_SUBSCRIBE,
+    INIT_SLOT_NUM,
+};
+
 typedef void (*init_func)(void);
 typedef struct {
     init_func func;
@@ -376,5 +432,18 @@ typedef struct {
 void init_func_list(void);
 void init_func_level(_u8_t level);
 void init_static_thread_list(void);
+void *init_slot_alloc(_u8_t type);
+void init_slot_free(_u8_t type, void *pSlot);
+void init_name_register(_u8_t type, void *pObject);
+void init_name_unregister(_u8_t type, void *pObject);
+void *init_name_lookup(_u8_t type, const _char_t *pName);
+
+/**
+ * The wait queue refresh hooks, they're installed into the statically defined kernel objects.
+ */
+void semaphore_queue_refresh(wait_queue_t *pQueue);
+void event_queue_refresh(wait_queue_t *pQueue);
+void rwlock_read_queue_refresh(wait_queue_t *pQueue);
+void rwlock_write_queue_refresh(wait_queue_t *pQueue);
 
 #endif
@@ -51,6 +51,7 @@
  * that drives the peripheral used to generate the kernels periodic tick interrupt.
  * The default value is set to 120mhz. Your application will certainly need a different value so set this correctly.
  * This is very often, but not always, equal to the main system clock frequency.
+ * It's the initial frequency, the os_timer_system_clock_set changes it at runtime.
  **/
 #define PORTAL_SYSTEM_CORE_CLOCK_MHZ (120u)
 
@@ -83,6 +84,12 @@
  **/
 #define EVENT_RUNTIME_NUMBER_SUPPORTED (10u)
 
+/**
+ * This symbol defined the blocking waiter number of each event that the set operation finds by the bit index.
+ * The default value is set to 8, it's up to 8. The waiters out of the index are found by walking the whole blocking list.
+ **/
+#define EVENT_WAITER_INDEX_NUMBER (8u)
+
 /**
  * This symbol defined the mutex instance number that your application is using.
  * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
@@ -90,6 +97,19 @@
  **/
 #define MUTEX_RUNTIME_NUMBER_SUPPORTED (10u)
 
+/**
+ * This symbol defined the rwlock instance number that your application is using.
+ * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the actual rwlock instance number that you created.
+ **/
+#define RWLOCK_RUNTIME_NUMBER_SUPPORTED (10u)
+
+/**
+ * This symbol defined the maximum reader thread number that holds one rwlock together.
+ * The default value is set to 4, it must be at least 1. The reader thread waits until one of the holding reader threads releases it.
+ **/
+#define RWLOCK_READER_NUMBER_SUPPORTED (4u)
+
 /**
  * This symbol defined the queue instance number that your application is using.
  * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
@@ -104,6 +124,51 @@
  **/
 #define TIMER_RUNTIME_NUMBER_SUPPORTED (10u)
 
+/**
+ * This symbol defined the timer callback service number, the service 0 runs the callbacks in the kernel thread.
+ * The default value is set to 1. Your application defines the other service threads with OS_TIMER_SERVICE_INIT,
+ * each one has its own priority, so the time-critical timers can be isolated from the bulk ones.
+ **/
+#define TIMER_SERVICE_NUMBER_SUPPORTED (1u)
+
+/**
+ * This symbol defined the low power state number that the idle governor can select.
+ * The default value is set to 4. The states are registered by the application with os_idle_state_register.
+ **/
+#define IDLE_STATE_NUMBER_SUPPORTED (4u)
+
+/**
+ * This symbol defined the maximum operation number that one kernel transaction can record.
+ * The default value is set to 4. The recorded operations are executed in one privileged entry by os_kernel_transaction_commit.
+ **/
+#define TRANSACTION_OPERATION_NUMBER_SUPPORTED (4u)
+
+/**
+ * This symbol enables the stackless tasks, they run to the completion or return at the explicit wait points,
+ * and all of them share the stack of one runner thread. The default value is set to 0.
+ * The runner thread stack size and priority are set by STACKLESS_RUNNER_STACK_SIZE and STACKLESS_RUNNER_PRIORITY.
+ **/
+#define STACKLESS_TASK_ENABLED (0)
+
+/**
+ * This symbol enables the context switch hooks registered at runtime by os_kernel_switch_hook_register.
+ * The default value is set to 0. The hooks known at compile time can be configured by SWITCH_OUT_HOOK_STATIC and
+ * SWITCH_IN_HOOK_STATIC with the function name instead, they're compiled to direct calls in the PendSV.
+ **/
+#define SWITCH_HOOK_DYNAMIC_ENABLED (0)
+
+/**
+ * This symbol defined the thread local storage slot number of each thread.
+ * The default value is set to 4, it must be at least 1. The slots of the running thread are accessed without the kernel trap.
+ **/
+#define THREAD_TLS_SLOT_NUMBER (4u)
+
+/**
+ * This symbol defined the bucket number of the kernel object name hash index.
+ * The default value is set to 16. More buckets make the name to id lookup shorter at the cost of one pointer per bucket.
+ **/
+#define NAME_HASH_BUCKET_NUMBER (16u)
+
 /**
  * This symbol defined the timer instance number that your application is using.
  * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
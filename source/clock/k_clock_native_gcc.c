@@ -14,15 +14,18 @@ typedef struct {
     /* The last load count value */
     _u32_t last_load;
 
-    /* The clock time total count value */
-    _u32_t total;
+    /* The clock time total count value, it's 64-bit to avoid the wrap in the long running */
+    _u64_t total;
 
     /* The clock time has reported count value */
-    _u32_t reported;
+    _u64_t reported;
 
     /* The hook function interface for clock time data pushing */
     time_report_handler_t pCallFunc;
 
+    /* The current core clock frequency (MHz) drives the clock count */
+    _u32_t mhz;
+
     /* The flag indicates the clock ctrl register enabled status */
     _b_t ctrl_enabled;
 } _clock_resource_t;
@@ -100,7 +103,54 @@ _u32_t clock_time_elapsed_get(void)
  *
  * @return Value of the current clock time.
  */
-_u32_t clock_time_get(void)
+_u64_t clock_time_get(void)
+{
+    /* Nothing need to do for kernel cmake sample build. */
+    return 0u;
+}
+
+/**
+ * @brief Switch the core clock frequency.
+ *
+ * @param mhz The new core clock frequency (MHz).
+ * @param pSwitchFunc The hook function to switch the core clock hardware, it supported NULL pointer.
+ */
+void clock_time_rate_set(_u32_t mhz, pClock_switchFunc_t pSwitchFunc)
+{
+    if (pSwitchFunc) {
+        pSwitchFunc(mhz);
+    }
+    g_clock_resource.mhz = mhz;
+}
+
+/**
+ * @brief Check if the core clock frequency is supported.
+ *
+ * @param mhz The core clock frequency (MHz).
+ *
+ * @return True if the frequency is supported, otherwise return false.
+ */
+_b_t clock_time_rate_isValid(_u32_t mhz)
+{
+    return (mhz) ? true : false;
+}
+
+/**
+ * @brief Get the current core clock frequency.
+ *
+ * @return Value of the core clock frequency (MHz).
+ */
+_u32_t clock_time_rate_get(void)
+{
+    return g_clock_resource.mhz;
+}
+
+/**
+ * @brief Get the number of the interval clamped to the clock limitation.
+ *
+ * @return Value of the clamped number.
+ */
+_u32_t clock_time_clamped_get(void)
 {
     /* Nothing need to do for kernel cmake sample build. */
     return 0u;
@@ -128,6 +178,7 @@ void clock_time_disable(void)
 void clock_time_init(time_report_handler_t pTime_function)
 {
     g_clock_resource.pCallFunc = pTime_function;
+    g_clock_resource.mhz = PORTAL_SYSTEM_CORE_CLOCK_MHZ;
 
     /* Nothing need to do for kernel cmake sample build. */
 }
@@ -7,26 +7,18 @@
 #include "./arch/k_arch.h"
 #include "./port/k_port.h"
 #include "./clock/k_clock_tick.h"
+#include "./clock/k_clock_reciprocal.h"
 #include "k_config.h"
 #include "k_type.h"
 
-/* Convert the microsecond to clock count */
-#define _CONVERT_MICROSENCOND_TO_COUNT(us) ((_u32_t)(us) * (PORTAL_SYSTEM_CORE_CLOCK_MHZ)-1u)
-
-/* Convert the clock count to microsecond */
-#define _CONVERT_COUNT_TO_MICROSENCOND(count) ((_u32_t)(count) / (PORTAL_SYSTEM_CORE_CLOCK_MHZ))
-
 enum {
-    /* The maximum timeout setting value */
-    _CLOCK_INTERVAL_MAX_US = (_CONVERT_COUNT_TO_MICROSENCOND(SysTick_LOAD_RELOAD_Msk)),
-
     /* The minimum timeout setting value is in order to avoid the clock dead looping call */
     _CLOCK_INTERVAL_MIN_US = (PORTAL_SYSTEM_CLOCK_INTERVAL_MIN_US),
-
-    /* The minimum count setting value is in order to avoid the clock dead looping call */
-    _CLOCK_INTERVAL_MIN_COUNT = (_CONVERT_MICROSENCOND_TO_COUNT(_CLOCK_INTERVAL_MIN_US)),
 };
 
+/* The maximum core clock frequency keeps the minimum interval count within the systick reload value */
+#define _CLOCK_RATE_MAX_MHZ (SysTick_LOAD_RELOAD_Msk / _CLOCK_INTERVAL_MIN_US)
+
 /**
  * Data structure for location time clock
  */
@@ -34,15 +26,33 @@ typedef struct {
     /* The last load count value */
     _u32_t last_load;
 
-    /* The clock time total count value */
-    _u32_t total;
+    /* The clock time total count value, it's 64-bit to avoid the wrap in the long running */
+    _u64_t total;
 
     /* The clock time has reported count value */
-    _u32_t reported;
+    _u64_t reported;
+
+    /* The clock time (us) accounted at the previous core clock frequencies */
+    _u64_t base_us;
+
+    /* The current core clock frequency (MHz) drives the clock count */
+    _u32_t mhz;
+
+    /* The maximum timeout setting value at the current core clock frequency */
+    _u32_t interval_max_us;
+
+    /* The minimum count setting value is in order to avoid the clock dead looping call */
+    _u32_t interval_min_count;
 
     /* The hook function interface for clock time data pushing */
     time_report_handler_t pCallFunc;
 
+    /* The reciprocal of the clock frequency (MHz) to convert the count to microsecond without division */
+    clock_reciprocal_t count_to_us;
+
+    /* The number of the interval clamped to the minimum or maximum */
+    _u32_t clamped;
+
     /* The flag indicates the clock ctrl register enabled status */
     _b_t ctrl_enabled;
 } _clock_resource_t;
@@ -52,6 +62,43 @@ typedef struct {
  */
 static _clock_resource_t g_clock_resource = {0u};
 
+/**
+ * @brief Convert the clock count to microsecond by the multiply-shift reciprocal.
+ *
+ * @param count The clock count value.
+ *
+ * @return Value of the microsecond.
+ */
+static _u32_t _clock_count_toUs(_u32_t count)
+{
+    return clock_reciprocal_divide(&g_clock_resource.count_to_us, count);
+}
+
+/**
+ * @brief Convert the microsecond to clock count at the current core clock frequency.
+ *
+ * @param us The microsecond value.
+ *
+ * @return Value of the clock count.
+ */
+static _u32_t _clock_us_toCount(_u32_t us)
+{
+    return (us * g_clock_resource.mhz) - 1u;
+}
+
+/**
+ * @brief Update the conversion factors for the new core clock frequency.
+ *
+ * @param mhz The core clock frequency (MHz).
+ */
+static void _clock_rate_update(_u32_t mhz)
+{
+    g_clock_resource.mhz = mhz;
+    clock_reciprocal_init(&g_clock_resource.count_to_us, mhz);
+    g_clock_resource.interval_max_us = SysTick_LOAD_RELOAD_Msk / mhz;
+    g_clock_resource.interval_min_count = _clock_us_toCount(_CLOCK_INTERVAL_MIN_US);
+}
+
 /**
  * @brief Detecting the wrap flag has to add the last load count into the clock total counter.
  *
@@ -108,14 +155,14 @@ void clock_isr(void)
     /**
      * For maintain purpose.
      */
-    _u32_t total_count = _clock_elapsed();
+    _u64_t total_count = _clock_elapsed();
     total_count += g_clock_resource.total;
 
     /**
      * Avoid the count lost.
      */
-    _u32_t elapsed_interval_us = _CONVERT_COUNT_TO_MICROSENCOND(total_count - g_clock_resource.reported);
-    g_clock_resource.reported += _CONVERT_MICROSENCOND_TO_COUNT(elapsed_interval_us);
+    _u32_t elapsed_interval_us = _clock_count_toUs((_u32_t)(total_count - g_clock_resource.reported));
+    g_clock_resource.reported += _clock_us_toCount(elapsed_interval_us);
 
     _clock_time_elapsed_report(elapsed_interval_us);
 }
@@ -137,12 +184,14 @@ void clock_time_interval_set(_u32_t interval_us)
 
     PORT_ENTER_CRITICAL_SECTION();
 
-    if (interval_us > _CLOCK_INTERVAL_MAX_US) {
-        interval_us = _CLOCK_INTERVAL_MAX_US;
+    if (interval_us > g_clock_resource.interval_max_us) {
+        interval_us = g_clock_resource.interval_max_us;
+        g_clock_resource.clamped++;
     } else if (interval_us < _CLOCK_INTERVAL_MIN_US) {
         interval_us = _CLOCK_INTERVAL_MIN_US;
+        g_clock_resource.clamped++;
     }
-    _u32_t set_count = _CONVERT_MICROSENCOND_TO_COUNT(interval_us);
+    _u32_t set_count = _clock_us_toCount(interval_us);
 
     _u32_t elapsed = _clock_elapsed();
 
@@ -157,15 +206,15 @@ void clock_time_interval_set(_u32_t interval_us)
     _u32_t last_load = g_clock_resource.last_load;
     _u32_t before = SysTick->VAL;
 
-    _u32_t unreported = g_clock_resource.total - g_clock_resource.reported;
+    _u32_t unreported = (_u32_t)(g_clock_resource.total - g_clock_resource.reported);
 
     if ((_i32_t)unreported < 0) {
-        g_clock_resource.last_load = _CONVERT_MICROSENCOND_TO_COUNT(100u);
+        g_clock_resource.last_load = _clock_us_toCount(100u);
     } else {
-        if ((interval_us != _CLOCK_INTERVAL_MAX_US) && (set_count > unreported)) {
+        if ((interval_us != g_clock_resource.interval_max_us) && (set_count > unreported)) {
             set_count -= unreported;
-            if (set_count < _CLOCK_INTERVAL_MIN_COUNT) {
-                set_count = _CLOCK_INTERVAL_MIN_COUNT;
+            if (set_count < g_clock_resource.interval_min_count) {
+                set_count = g_clock_resource.interval_min_count;
             }
         }
 
@@ -196,7 +245,7 @@ _u32_t clock_time_elapsed_get(void)
 {
     PORT_ENTER_CRITICAL_SECTION();
 
-    _u32_t us = _CONVERT_COUNT_TO_MICROSENCOND(_clock_elapsed() + g_clock_resource.total - g_clock_resource.reported);
+    _u32_t us = _clock_count_toUs((_u32_t)(_clock_elapsed() + g_clock_resource.total - g_clock_resource.reported));
 
     PORT_EXIT_CRITICAL_SECTION();
 
@@ -208,17 +257,107 @@ _u32_t clock_time_elapsed_get(void)
  *
  * @return Value of the current clock time.
  */
-_u32_t clock_time_get(void)
+_u64_t clock_time_get(void)
 {
     PORT_ENTER_CRITICAL_SECTION();
 
-    _u32_t us = _CONVERT_COUNT_TO_MICROSENCOND(g_clock_resource.total + _clock_elapsed());
+    _u64_t us = g_clock_resource.base_us + ((g_clock_resource.total + _clock_elapsed()) / g_clock_resource.mhz);
 
     PORT_EXIT_CRITICAL_SECTION();
 
     return us;
 }
 
+/**
+ * @brief Switch the core clock frequency, the elapsed count is accounted at the old frequency
+ *        and the unreported count is carried to the new frequency, so the kernel time keeps continuous.
+ *
+ * @param mhz The new core clock frequency (MHz).
+ * @param pSwitchFunc The hook function to switch the core clock hardware, it supported NULL pointer.
+ */
+void clock_time_rate_set(_u32_t mhz, pClock_switchFunc_t pSwitchFunc)
+{
+    if (!clock_time_rate_isValid(mhz)) {
+        return;
+    }
+
+    PORT_ENTER_CRITICAL_SECTION();
+
+    /**
+     * Freeze the clock counter while the core clock is switching,
+     * the counting at an unknown frequency can't be converted correctly.
+     */
+    g_clock_resource.total += _clock_elapsed();
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    _u32_t old_mhz = g_clock_resource.mhz;
+    if (g_clock_resource.total >= g_clock_resource.reported) {
+        _u64_t unreported = g_clock_resource.total - g_clock_resource.reported;
+        g_clock_resource.base_us += g_clock_resource.reported / old_mhz;
+        g_clock_resource.total = (unreported * mhz) / old_mhz;
+        g_clock_resource.reported = 0u;
+    } else {
+        _u64_t overreported = g_clock_resource.reported - g_clock_resource.total;
+        g_clock_resource.base_us += g_clock_resource.total / old_mhz;
+        g_clock_resource.total = 0u;
+        g_clock_resource.reported = (overreported * mhz) / old_mhz;
+    }
+
+    if (pSwitchFunc) {
+        pSwitchFunc(mhz);
+    }
+    _clock_rate_update(mhz);
+
+    /**
+     * Restart the counter with the full reload, the kernel timer reprograms the next interval later.
+     */
+    g_clock_resource.last_load = SysTick_LOAD_RELOAD_Msk;
+    SysTick->LOAD = g_clock_resource.last_load;
+    SysTick->VAL = 0x0u;
+    (void)SysTick->CTRL;
+    if (g_clock_resource.ctrl_enabled) {
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    }
+
+    PORT_EXIT_CRITICAL_SECTION();
+}
+
+/**
+ * @brief Check if the core clock frequency is supported by the systick.
+ *
+ * @param mhz The core clock frequency (MHz).
+ *
+ * @return True if the frequency is supported, otherwise return false.
+ */
+_b_t clock_time_rate_isValid(_u32_t mhz)
+{
+    /**
+     * The microsecond to count conversion is taken in 32 bits, the interval is clamped to the maximum reload value first,
+     * so it doesn't overflow as long as the minimum interval is within the reload value.
+     */
+    return ((mhz) && (mhz <= _CLOCK_RATE_MAX_MHZ)) ? true : false;
+}
+
+/**
+ * @brief Get the current core clock frequency.
+ *
+ * @return Value of the core clock frequency (MHz).
+ */
+_u32_t clock_time_rate_get(void)
+{
+    return g_clock_resource.mhz;
+}
+
+/**
+ * @brief Get the number of the interval clamped to the clock limitation.
+ *
+ * @return Value of the clamped number.
+ */
+_u32_t clock_time_clamped_get(void)
+{
+    return g_clock_resource.clamped;
+}
+
 /**
  * @brief If the clock time was disabled.
  */
@@ -252,6 +391,7 @@ void clock_time_disable(void)
 void clock_time_init(time_report_handler_t pTime_function)
 {
     g_clock_resource.pCallFunc = pTime_function;
+    _clock_rate_update(PORTAL_SYSTEM_CORE_CLOCK_MHZ);
 
     NVIC_SetPriority(SysTick_IRQn, 0xFFu);
     g_clock_resource.last_load = SysTick_LOAD_RELOAD_Msk;
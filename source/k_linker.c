@@ -334,6 +334,98 @@ list_node_t *list_node_pop(list_t *pList, list_direction_t direction)
     return NULL;
 }
 
+/**
+ * @brief To push a node into the fifo tail.
+ *
+ * @param pFifo The pointer of the fifo.
+ * @param pInNode The pointer of the pushed node.
+ *
+ * @return The value true indicates the process is successful, otherwise is failed.
+ */
+_b_t list_fifo_push(list_fifo_t *pFifo, list_node_t *pInNode)
+{
+    if (!pFifo) {
+        return false;
+    }
+
+    if (!pInNode) {
+        return false;
+    }
+
+    pInNode->pNext = NULL;
+    if (pFifo->pTail) {
+        pFifo->pTail->pNext = pInNode;
+    } else {
+        pFifo->pHead = pInNode;
+    }
+    pFifo->pTail = pInNode;
+
+    return true;
+}
+
+/**
+ * @brief To pop a node from the fifo head.
+ *
+ * @param pFifo The pointer of the fifo.
+ *
+ * @return The value is node pointer, but the null indicates there is no available node to pop.
+ */
+list_node_t *list_fifo_pop(list_fifo_t *pFifo)
+{
+    if (!pFifo) {
+        return NULL;
+    }
+
+    list_node_t *pOutNode = pFifo->pHead;
+    if (pOutNode) {
+        pFifo->pHead = pOutNode->pNext;
+        if (!pFifo->pHead) {
+            pFifo->pTail = NULL;
+        }
+        pOutNode->pNext = NULL;
+    }
+
+    return pOutNode;
+}
+
+/**
+ * @brief To remove a node from the fifo.
+ *
+ * @param pFifo The pointer of the fifo.
+ * @param pTargetNode The pointer of the node to be removed.
+ *
+ * @return The value true indicates the node was found and removed, otherwise is failed.
+ */
+_b_t list_fifo_remove(list_fifo_t *pFifo, list_node_t *pTargetNode)
+{
+    if ((!pFifo) || (!pTargetNode)) {
+        return false;
+    }
+
+    list_node_t *pPrev = NULL;
+    list_node_t *pCur = pFifo->pHead;
+    while ((pCur) && (pCur != pTargetNode)) {
+        pPrev = pCur;
+        pCur = pCur->pNext;
+    }
+
+    if (!pCur) {
+        return false;
+    }
+
+    if (pPrev) {
+        pPrev->pNext = pCur->pNext;
+    } else {
+        pFifo->pHead = pCur->pNext;
+    }
+    if (pFifo->pTail == pCur) {
+        pFifo->pTail = pPrev;
+    }
+    pCur->pNext = NULL;
+
+    return true;
+}
+
 /**
  * @brief Initialize a iterator to traverse all node in the list from the list head.
  *
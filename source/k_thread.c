@@ -13,6 +13,7 @@ INIT_OS_THREAD_RUNTIME_NUM_DEFINE(THREAD_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_TIMER_RUNTIME_NUM_DEFINE(TIMER_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_SEM_RUNTIME_NUM_DEFINE(SEMAPHORE_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_MUTEX_RUNTIME_NUM_DEFINE(MUTEX_RUNTIME_NUMBER_SUPPORTED);
+INIT_OS_RWLOCK_RUNTIME_NUM_DEFINE(RWLOCK_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_EVT_RUNTIME_NUM_DEFINE(EVENT_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_MSGQ_RUNTIME_NUM_DEFINE(QUEUE_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_POOL_RUNTIME_NUM_DEFINE(POOL_RUNTIME_NUMBER_SUPPORTED);
@@ -21,6 +22,9 @@ INIT_OS_SUBSCRIBE_RUNTIME_NUM_DEFINE(SUBSCRIBE_RUNTIME_NUMBER_SUPPORTED);
 
 INIT_OS_THREAD_DEFINE(kernel_th, OS_PRIORITY_KERNEL_SCHEDULE_LEVEL, KERNEL_SCHEDULE_THREAD_STACK_SIZE, kernel_schedule_thread, NULL);
 INIT_OS_THREAD_DEFINE(idle_th, OS_PRIORITY_KERNEL_IDLE_LEVEL, KERNEL_IDLE_THREAD_STACK_SIZE, kernel_idle_thread, NULL);
+#if (STACKLESS_TASK_ENABLED)
+INIT_OS_THREAD_DEFINE(stackless_th, STACKLESS_RUNNER_PRIORITY, STACKLESS_RUNNER_STACK_SIZE, kernel_stackless_thread, NULL);
+#endif
 INIT_OS_SEMAPHORE_DEFINE(kernel_sem, 0u, OS_SEM_LIMIT_BINARY);
 
 static pThread_entryFunc_t g_idle_thread_user_entry_fn = NULL;
@@ -33,6 +37,7 @@ const at_rtos_api_t os = {
     .thread_init = os_thread_init,
     .thread_name_toId = os_thread_name_toId,
     .thread_sleep = os_thread_sleep,
+    .thread_sleep_us = os_thread_sleep_us,
     .thread_resume = os_thread_resume,
     .thread_suspend = os_thread_suspend,
     .thread_yield = os_thread_yield,
@@ -42,48 +47,92 @@ const at_rtos_api_t os = {
     .thread_idle_fn_register = os_thread_idle_callback_register,
     .thread_user_data_set = os_thread_user_data_set,
     .thread_user_data_get = os_thread_user_data_get,
+    .thread_tls_set = os_thread_tls_set,
+    .thread_tls_get = os_thread_tls_get,
+    .stackless_init = os_stackless_init,
     .thread_idle_id_probe = os_thread_idle_id_probe,
+    .idle_state_register = os_idle_state_register,
+    .idle_state_residency_get = os_idle_state_residency_get,
     .thread_stack_free_size_probe = os_thread_stack_free_size_probe,
+    .thread_fpu_switch_probe = os_thread_fpu_switch_probe,
+    .thread_priority_set = os_thread_priority_set,
+    .thread_priority_get = os_thread_priority_get,
 
     .timer_init = os_timer_init,
     .timer_automatic = os_timer_automatic,
+    .timer_name_toId = os_timer_name_toId,
     .timer_start = os_timer_start,
+    .timer_start_us = os_timer_start_us,
+    .timer_service_set = os_timer_service_set,
+    .timer_catchup_set = os_timer_catchup_set,
+    .timer_overrun_get = os_timer_overrun_get,
+    .timer_lateness_get = os_timer_lateness_get,
+    .timer_system_lateness_get = os_timer_system_lateness_get,
+    .timer_slack_set = os_timer_slack_set,
     .timer_stop = os_timer_stop,
     .timer_busy = os_timer_busy,
     .timer_delete = os_timer_delete,
     .timer_system_total_ms = os_timer_system_total_ms,
+    .timer_system_total_us = os_timer_system_total_us,
     .timer_system_busy_wait = os_timer_system_busy_wait,
+    .timer_system_clock_set = os_timer_system_clock_set,
+    .timer_system_clock_get = os_timer_system_clock_get,
 
     .sem_init = os_sem_init,
+    .sem_name_toId = os_sem_name_toId,
     .sem_take = os_sem_take,
     .sem_give = os_sem_give,
+    .sem_take_n = os_sem_take_n,
+    .sem_give_n = os_sem_give_n,
     .sem_flush = os_sem_flush,
+    .sem_wait_order_set = os_sem_wait_order_set,
     .sem_delete = os_sem_delete,
 
     .mutex_init = os_mutex_init,
+    .mutex_name_toId = os_mutex_name_toId,
     .mutex_lock = os_mutex_lock,
     .mutex_unlock = os_mutex_unlock,
+    .mutex_cond_wait = os_mutex_cond_wait,
+    .mutex_cond_signal = os_mutex_cond_signal,
+    .mutex_cond_broadcast = os_mutex_cond_broadcast,
+    .mutex_wait_order_set = os_mutex_wait_order_set,
     .mutex_delete = os_mutex_delete,
 
+    .rwlock_init = os_rwlock_init,
+    .rwlock_name_toId = os_rwlock_name_toId,
+    .rwlock_read_lock = os_rwlock_read_lock,
+    .rwlock_write_lock = os_rwlock_write_lock,
+    .rwlock_unlock = os_rwlock_unlock,
+    .rwlock_delete = os_rwlock_delete,
+
     .evt_init = os_evt_init,
+    .evt_name_toId = os_evt_name_toId,
     .evt_set = os_evt_set,
     .evt_wait = os_evt_wait,
+    .evt_wait_option = os_evt_wait_option,
+    .evt_wait_order_set = os_evt_wait_order_set,
     .evt_delete = os_evt_delete,
 
     .msgq_init = os_msgq_init,
+    .msgq_name_toId = os_msgq_name_toId,
     .msgq_put = os_msgq_put,
     .msgq_get = os_msgq_get,
     .msgq_num_probe = os_msgq_num_probe,
+    .msgq_wait_order_set = os_msgq_wait_order_set,
     .msgq_delete = os_msgq_delete,
 
     .pool_init = os_pool_init,
+    .pool_name_toId = os_pool_name_toId,
     .pool_take = os_pool_take,
     .pool_release = os_pool_release,
+    .pool_wait_order_set = os_pool_wait_order_set,
     .pool_delete = os_pool_delete,
 
     .publish_init = os_publish_init,
+    .publish_name_toId = os_publish_name_toId,
     .publish_data_submit = os_publish_data_submit,
     .subscribe_init = os_subscribe_init,
+    .subscribe_name_toId = os_subscribe_name_toId,
     .subscribe_register = os_subscribe_register,
     .subscribe_data_apply = os_subscribe_data_apply,
     .subscribe_data_is_ready = os_subscribe_data_is_ready,
@@ -93,6 +142,13 @@ const at_rtos_api_t os = {
     .schedule_is_running = os_kernel_is_running,
     .schedule_lock = os_kernel_lock,
     .schedule_unlock = os_kernel_unlock,
+    .transaction_init = os_kernel_transaction_init,
+    .transaction_sem_give = os_kernel_transaction_sem_give,
+    .transaction_evt_set = os_kernel_transaction_evt_set,
+    .transaction_msgq_put = os_kernel_transaction_msgq_put,
+    .transaction_commit = os_kernel_transaction_commit,
+    .transaction_result = os_kernel_transaction_result,
+    .switch_hook_register = os_kernel_switch_hook_register,
 
     .trace_versison = os_trace_firmware_version,
     .trace_postcode_fn_register = os_trace_postcode_callback_register,
@@ -71,6 +71,11 @@ void _impl_trace_thread(const pTrace_threadFunc_t fn)
 {
     INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
     {
+        if (!pCurThread->head.cs) {
+            /* The free runtime thread slot */
+            continue;
+        }
+
         if (fn) {
             fn((const thread_context_t *)pCurThread);
         }
@@ -84,6 +89,11 @@ void _impl_trace_analyze(const pTrace_analyzeFunc_t fn)
 {
     INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
     {
+        if (!pCurThread->head.cs) {
+            /* The free runtime thread slot */
+            continue;
+        }
+
         if (fn) {
             fn(pCurThread->task.exec.analyze);
         }
@@ -147,36 +147,33 @@ static _u32_t _pool_init_privilege_routine(arguments_t *pArgs)
     _u16_t elementNum = (_u16_t)(pArgs[2].u16_val);
     const _char_t *pName = (const _char_t *)(pArgs[3].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_POOL_LIST, pool_context_t, pCurPool)
-    {
-        if (_pool_context_isInvalid(pCurPool)) {
-            break;
-        }
+    pool_context_t *pCurPool = (pool_context_t *)init_slot_alloc(INIT_SLOT_POOL);
+    if (!pCurPool) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        if (_pool_context_isInit(pCurPool)) {
-            continue;
-        }
-        k_memset((_char_t *)pCurPool, 0x0u, sizeof(pool_context_t));
-        pCurPool->head.cs = CS_INITED;
-        pCurPool->head.pName = pName;
+    k_memset((_char_t *)pCurPool, 0x0u, sizeof(pool_context_t));
+    pCurPool->head.cs = CS_INITED;
+    pCurPool->head.pName = pName;
+    if (!pMemAddr) {
+        pMemAddr = (_u32_t *)k_malloc(elementLen * elementNum);
         if (!pMemAddr) {
-            pMemAddr = (_u32_t *)k_malloc(elementLen * elementNum);
-            if (!pMemAddr) {
-                EXIT_CRITICAL_SECTION();
-                return 0u;
-            }
+            k_memset((_char_t *)pCurPool, 0x0u, sizeof(pool_context_t));
+            init_slot_free(INIT_SLOT_POOL, pCurPool);
+            EXIT_CRITICAL_SECTION();
+            return 0u;
         }
-        pCurPool->pMemAddress = pMemAddr;
-        pCurPool->elementLength = elementLen;
-        pCurPool->elementNumber = elementNum;
-        pCurPool->elementFreeBits = Bs(0u, (elementNum - 1u));
+    }
+    pCurPool->pMemAddress = pMemAddr;
+    pCurPool->elementLength = elementLen;
+    pCurPool->elementNumber = elementNum;
+    pCurPool->elementFreeBits = Bs(0u, (elementNum - 1u));
 
-        EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurPool;
-    };
+    init_name_register(INIT_SLOT_POOL, pCurPool);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurPool;
 }
 
 /**
@@ -248,7 +245,7 @@ static _i32p_t _pool_release_privilege_routine(arguments_t *pArgs)
 
     /* Try to wakeup a blocking thread */
     list_iterator_t it = {0u};
-    list_t *pList = (list_t *)&pCurPool->q_list;
+    list_t *pList = &pCurPool->q_list.list;
     list_iterator_init(&it, pList);
     struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
     if (pCurTask) {
@@ -259,6 +256,29 @@ static _i32p_t _pool_release_privilege_routine(arguments_t *pArgs)
     return postcode;
 }
 
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _pool_wait_order_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    pool_context_t *pCurPool = (pool_context_t *)pArgs[0].u32_val;
+    _u8_t order = (_u8_t)pArgs[1].u8_val;
+    _i32p_t postcode = 0;
+
+    if (!schedule_wait_order_set(&pCurPool->q_list, order)) {
+        postcode = PC_EOR;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -274,7 +294,7 @@ static _i32p_t _pool_delete_privilege_routine(arguments_t *pArgs)
     _i32p_t postcode = 0;
 
     list_iterator_t it = {0u};
-    list_t *plist = (list_t *)&pCurPool->q_list;
+    list_t *plist = &pCurPool->q_list.list;
     list_iterator_init(&it, plist);
     struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
     while (pCurTask) {
@@ -290,7 +310,9 @@ static _i32p_t _pool_delete_privilege_routine(arguments_t *pArgs)
     } else {
         k_memset((_char_t *)pCurPool->pMemAddress, 0, pCurPool->elementLength * pCurPool->elementNumber);
     }
+    init_name_unregister(INIT_SLOT_POOL, pCurPool);
     k_memset((_char_t *)pCurPool, 0x0u, sizeof(pool_context_t));
+    init_slot_free(INIT_SLOT_POOL, pCurPool);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -330,6 +352,20 @@ _u32_t _impl_pool_init(const void *pMemAddr, _u16_t elementLen, _u16_t elementNu
     return kernel_privilege_invoke((const void *)_pool_init_privilege_routine, arguments);
 }
 
+/**
+ * @brief Find a pool id by its name.
+ *
+ * @param pName The pool name.
+ *
+ * @return The value of pool unique id.
+ */
+_u32_t _impl_pool_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_POOL, pName);
+}
+
 /**
  * @brief Take a message pool resource.
  *
@@ -405,6 +441,37 @@ _i32p_t _impl_pool_release(_u32_t ctx, void **ppUserBuffer)
     return kernel_privilege_invoke((const void *)_pool_release_privilege_routine, arguments);
 }
 
+/**
+ * @brief Set the blocking threads waiting order of the pool, it's allowed when no thread is blocking.
+ *
+ * @param id The pool unique id.
+ * @param order The waiting order, the priority or the arrival order.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_pool_wait_order_set(_u32_t ctx, _u8_t order)
+{
+    pool_context_t *pCtx = (pool_context_t *)ctx;
+    if (_pool_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_pool_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((order != WAIT_ORDER_PRIORITY_VAL) && (order != WAIT_ORDER_FIFO_VAL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u8_val = (_u8_t)order},
+    };
+
+    return kernel_privilege_invoke((const void *)_pool_wait_order_set_privilege_routine, arguments);
+}
+
 /**
  * @brief Release memory pool.
  *
@@ -187,40 +187,36 @@ static _u32_t _queue_init_privilege_routine(arguments_t *pArgs)
     _u16_t elementNum = (_u16_t)(pArgs[2].u16_val);
     const _char_t *pName = (const _char_t *)(pArgs[3].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_QUEUE_LIST, queue_context_t, pCurQueue)
-    {
-        if (_queue_context_isInvalid(pCurQueue)) {
-            break;
-        }
-
-        if (_queue_context_isInit(pCurQueue)) {
-            continue;
-        }
+    queue_context_t *pCurQueue = (queue_context_t *)init_slot_alloc(INIT_SLOT_QUEUE);
+    if (!pCurQueue) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        k_memset((_char_t *)pCurQueue, 0x0u, sizeof(queue_context_t));
-        pCurQueue->head.cs = CS_INITED;
-        pCurQueue->head.pName = pName;
+    k_memset((_char_t *)pCurQueue, 0x0u, sizeof(queue_context_t));
+    pCurQueue->head.cs = CS_INITED;
+    pCurQueue->head.pName = pName;
 
+    if (!pQueueBufferAddr) {
+        pQueueBufferAddr = (_u32_t *)k_malloc(elementLen * elementNum);
         if (!pQueueBufferAddr) {
-            pQueueBufferAddr = (_u32_t *)k_malloc(elementLen * elementNum);
-            if (!pQueueBufferAddr) {
-                EXIT_CRITICAL_SECTION();
-                return 0u;
-            }
+            k_memset((_char_t *)pCurQueue, 0x0u, sizeof(queue_context_t));
+            init_slot_free(INIT_SLOT_QUEUE, pCurQueue);
+            EXIT_CRITICAL_SECTION();
+            return 0u;
         }
-        pCurQueue->pQueueBufferAddress = pQueueBufferAddr;
-        pCurQueue->elementLength = elementLen;
-        pCurQueue->elementNumber = elementNum;
-        pCurQueue->leftPosition = 0u;
-        pCurQueue->rightPosition = 0u;
-        pCurQueue->cacheSize = 0u;
+    }
+    pCurQueue->pQueueBufferAddress = pQueueBufferAddr;
+    pCurQueue->elementLength = elementLen;
+    pCurQueue->elementNumber = elementNum;
+    pCurQueue->leftPosition = 0u;
+    pCurQueue->rightPosition = 0u;
+    pCurQueue->cacheSize = 0u;
 
-        EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurQueue;
-    };
+    init_name_register(INIT_SLOT_QUEUE, pCurQueue);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurQueue;
 }
 
 /**
@@ -253,8 +249,6 @@ static _i32p_t _queue_send_privilege_routine(arguments_t *pArgs)
     _u32_t timeout_ms = (_u32_t)pArgs[2].u32_val;
     _i32p_t postcode = 0;
 
-    thread_context_t *pCurThread = kernel_thread_runContextGet();
-
     if (pQue_sch->size == 0) {
         pQue_sch->size = pCurQueue->elementLength;
     }
@@ -269,7 +263,7 @@ static _i32p_t _queue_send_privilege_routine(arguments_t *pArgs)
             EXIT_CRITICAL_SECTION();
             return PC_EOR;
         }
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurQueue, pQue_sch, &pCurQueue->in_QList, timeout_ms, true);
+        postcode = schedule_exit_trigger(kernel_task_runGet(), pCurQueue, pQue_sch, &pCurQueue->in_QList, timeout_ms, true);
         PC_IF(postcode, PC_PASS)
         {
             postcode = PC_OS_WAIT_UNAVAILABLE;
@@ -283,7 +277,7 @@ static _i32p_t _queue_send_privilege_routine(arguments_t *pArgs)
 
         /* Try to wakeup a blocking thread */
         list_iterator_t it = {0u};
-        list_t *plist = (list_t *)&pCurQueue->out_QList;
+        list_t *plist = &pCurQueue->out_QList.list;
         list_iterator_init(&it, plist);
         struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
         if (pCurTask) {
@@ -311,8 +305,6 @@ static _i32p_t _queue_receive_privilege_routine(arguments_t *pArgs)
     _u32_t timeout_ms = (_u32_t)pArgs[2].u32_val;
     _i32p_t postcode = 0;
 
-    thread_context_t *pCurThread = (thread_context_t *)kernel_thread_runContextGet();
-
     if (pQue_sch->size == 0) {
         pQue_sch->size = pCurQueue->elementLength;
     }
@@ -327,7 +319,7 @@ static _i32p_t _queue_receive_privilege_routine(arguments_t *pArgs)
             EXIT_CRITICAL_SECTION();
             return PC_OS_WAIT_NODATA;
         }
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurQueue, pQue_sch, &pCurQueue->out_QList, timeout_ms, true);
+        postcode = schedule_exit_trigger(kernel_task_runGet(), pCurQueue, pQue_sch, &pCurQueue->out_QList, timeout_ms, true);
         PC_IF(postcode, PC_PASS)
         {
             postcode = PC_OS_WAIT_UNAVAILABLE;
@@ -341,7 +333,7 @@ static _i32p_t _queue_receive_privilege_routine(arguments_t *pArgs)
 
         /* Try to wakeup a blocking task */
         list_iterator_t it = {0u};
-        list_t *plist = (list_t *)&pCurQueue->in_QList;
+        list_t *plist = &pCurQueue->in_QList.list;
         list_iterator_init(&it, plist);
         struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
         if (pCurTask) {
@@ -353,6 +345,32 @@ static _i32p_t _queue_receive_privilege_routine(arguments_t *pArgs)
     return postcode;
 }
 
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _queue_wait_order_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    queue_context_t *pCurQueue = (queue_context_t *)pArgs[0].u32_val;
+    _u8_t order = (_u8_t)pArgs[1].u8_val;
+    _i32p_t postcode = 0;
+
+    if ((pCurQueue->in_QList.list.pHead) || (pCurQueue->out_QList.list.pHead)) {
+        postcode = PC_EOR;
+    } else {
+        schedule_wait_order_set(&pCurQueue->in_QList, order);
+        schedule_wait_order_set(&pCurQueue->out_QList, order);
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -368,7 +386,7 @@ static _i32p_t _queue_delete_privilege_routine(arguments_t *pArgs)
     _i32p_t postcode = 0;
 
     list_iterator_t it = {0u};
-    list_t *plist = (list_t *)&pCurQueue->in_QList;
+    list_t *plist = &pCurQueue->in_QList.list;
     list_iterator_init(&it, plist);
     struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
     while (pCurTask) {
@@ -379,7 +397,7 @@ static _i32p_t _queue_delete_privilege_routine(arguments_t *pArgs)
         pCurTask = (struct schedule_task *)list_iterator_next(&it);
     }
 
-    plist = (list_t *)&pCurQueue->out_QList;
+    plist = &pCurQueue->out_QList.list;
     list_iterator_init(&it, plist);
     pCurTask = (struct schedule_task *)list_iterator_next(&it);
     while (pCurTask) {
@@ -395,7 +413,9 @@ static _i32p_t _queue_delete_privilege_routine(arguments_t *pArgs)
     } else {
         k_memset((_char_t *)pCurQueue->pQueueBufferAddress, 0, pCurQueue->elementLength * pCurQueue->elementNumber);
     }
+    init_name_unregister(INIT_SLOT_QUEUE, pCurQueue);
     k_memset((_char_t *)pCurQueue, 0x0u, sizeof(queue_context_t));
+    init_slot_free(INIT_SLOT_QUEUE, pCurQueue);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -431,6 +451,20 @@ _u32_t _impl_queue_init(const void *pQueueBufferAddr, _u16_t elementLen, _u16_t
     return kernel_privilege_invoke((const void *)_queue_init_privilege_routine, arguments);
 }
 
+/**
+ * @brief Find a queue id by its name.
+ *
+ * @param pName The queue name.
+ *
+ * @return The value of queue unique id.
+ */
+_u32_t _impl_queue_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_QUEUE, pName);
+}
+
 /**
  * @brief Get the received msg number.
  *
@@ -484,15 +518,22 @@ _i32p_t _impl_queue_send(_u32_t ctx, const _u8_t *pUserBuffer, _u16_t bufferSize
     }
 
     queue_sch_t que_sch = {.pUsrBuf = pUserBuffer, .size = bufferSize, .reverse = isToFront};
+    queue_sch_t *pQue_sch = &que_sch;
+    struct stackless_task *pStackless = kernel_stackless_runGet();
+    if (pStackless) {
+        pStackless->pend.data.que = que_sch;
+        pQue_sch = &pStackless->pend.data.que;
+    }
+
     arguments_t arguments[] = {
         [0] = {.u32_val = (_u32_t)ctx},
-        [1] = {.ptr_val = (void *)&que_sch},
+        [1] = {.ptr_val = (void *)pQue_sch},
         [2] = {.u32_val = (_u32_t)timeout_ms},
     };
     _i32p_t postcode = kernel_privilege_invoke((const void *)_queue_send_privilege_routine, arguments);
 
     ENTER_CRITICAL_SECTION();
-    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+    if ((postcode == PC_OS_WAIT_UNAVAILABLE) && (!pStackless)) {
         postcode = kernel_schedule_result_take();
     }
 
@@ -529,16 +570,23 @@ _i32p_t _impl_queue_receive(_u32_t ctx, const _u8_t *pUserBuffer, _u16_t bufferS
     }
 
     queue_sch_t que_sch = {.pUsrBuf = pUserBuffer, .size = bufferSize, .reverse = isFromBack};
+    queue_sch_t *pQue_sch = &que_sch;
+    struct stackless_task *pStackless = kernel_stackless_runGet();
+    if (pStackless) {
+        pStackless->pend.data.que = que_sch;
+        pQue_sch = &pStackless->pend.data.que;
+    }
+
     arguments_t arguments[] = {
         [0] = {.u32_val = (_u32_t)ctx},
-        [1] = {.ptr_val = (void *)&que_sch},
+        [1] = {.ptr_val = (void *)pQue_sch},
         [2] = {.u32_val = (_u32_t)timeout_ms},
     };
     _i32p_t postcode = kernel_privilege_invoke((const void *)_queue_receive_privilege_routine, arguments);
 
     ENTER_CRITICAL_SECTION();
 
-    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+    if ((postcode == PC_OS_WAIT_UNAVAILABLE) && (!pStackless)) {
         postcode = kernel_schedule_result_take();
     }
 
@@ -546,6 +594,37 @@ _i32p_t _impl_queue_receive(_u32_t ctx, const _u8_t *pUserBuffer, _u16_t bufferS
     return postcode;
 }
 
+/**
+ * @brief Set the blocking threads waiting order of the queue, it's allowed when no thread is blocking.
+ *
+ * @param id The queue unique id.
+ * @param order The waiting order, the priority or the arrival order.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_queue_wait_order_set(_u32_t ctx, _u8_t order)
+{
+    queue_context_t *pCtx = (queue_context_t *)ctx;
+    if (_queue_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_queue_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((order != WAIT_ORDER_PRIORITY_VAL) && (order != WAIT_ORDER_FIFO_VAL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u8_val = (_u8_t)order},
+    };
+
+    return kernel_privilege_invoke((const void *)_queue_wait_order_set_privilege_routine, arguments);
+}
+
 /**
  * @brief Delete a queue.
  *
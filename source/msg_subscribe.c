@@ -18,7 +18,7 @@
  * Data structure for location timer
  */
 typedef struct {
-    list_t callback_list;
+    list_fifo_t callback_fifo;
 } _sp_resource_t;
 
 /**
@@ -111,26 +111,20 @@ static _u32_t _publish_init_privilege_routine(arguments_t *pArgs)
 
     const _char_t *pName = (const _char_t *)(pArgs[0].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_PUBLISH_LIST, publish_context_t, pCurPublish)
-    {
-        if (_publish_context_isInvalid(pCurPublish)) {
-            break;
-        }
+    publish_context_t *pCurPublish = (publish_context_t *)init_slot_alloc(INIT_SLOT_PUBLISH);
+    if (!pCurPublish) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        if (_publish_context_isInit(pCurPublish)) {
-            continue;
-        }
+    k_memset((_char_t *)pCurPublish, 0x0u, sizeof(publish_context_t));
+    pCurPublish->head.cs = CS_INITED;
+    pCurPublish->head.pName = pName;
 
-        k_memset((_char_t *)pCurPublish, 0x0u, sizeof(publish_context_t));
-        pCurPublish->head.cs = CS_INITED;
-        pCurPublish->head.pName = pName;
-
-        EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurPublish;
-    };
+    init_name_register(INIT_SLOT_PUBLISH, pCurPublish);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurPublish;
 }
 
 /**
@@ -175,9 +169,9 @@ void subscribe_notification(void *pNode)
 {
     subscribe_context_t *pCurSubscribe = (subscribe_context_t *)CONTAINEROF(pNode, subscribe_context_t, notify);
 
-    list_t *pCallback_list = (list_t *)&g_sp_rsc.callback_list;
-    if (!list_node_isExisted(pCallback_list, &pCurSubscribe->call.node)) {
-        list_node_push((list_t *)&g_sp_rsc.callback_list, &pCurSubscribe->call.node, LIST_HEAD);
+    if (!pCurSubscribe->call.queued) {
+        pCurSubscribe->call.queued = true;
+        list_fifo_push(&g_sp_rsc.callback_fifo, &pCurSubscribe->call.node);
     }
 }
 
@@ -196,41 +190,37 @@ static _u32_t _subscribe_init_privilege_routine(arguments_t *pArgs)
     _u16_t size = (_u16_t)pArgs[1].u16_val;
     const _char_t *pName = (const _char_t *)(pArgs[2].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_SUBSCRIBE_LIST, subscribe_context_t, pCurSubscribe)
-    {
-        if (_subscribe_context_isInvalid(pCurSubscribe)) {
-            break;
-        }
-
-        if (_subscribe_context_isInit(pCurSubscribe)) {
-            continue;
-        }
+    subscribe_context_t *pCurSubscribe = (subscribe_context_t *)init_slot_alloc(INIT_SLOT_SUBSCRIBE);
+    if (!pCurSubscribe) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        k_memset((_char_t *)pCurSubscribe, 0x0u, sizeof(subscribe_context_t));
-        pCurSubscribe->head.cs = CS_INITED;
-        pCurSubscribe->head.pName = pName;
+    k_memset((_char_t *)pCurSubscribe, 0x0u, sizeof(subscribe_context_t));
+    pCurSubscribe->head.cs = CS_INITED;
+    pCurSubscribe->head.pName = pName;
 
-        pCurSubscribe->pPublisher = NULL;
-        pCurSubscribe->accepted = 0u;
+    pCurSubscribe->pPublisher = NULL;
+    pCurSubscribe->accepted = 0u;
 
+    if (!pData) {
+        pData = (_u32_t *)k_malloc(size);
         if (!pData) {
-            pData = (_u32_t *)k_malloc(size);
-            if (!pData) {
-                EXIT_CRITICAL_SECTION();
-                return 0u;
-            }
+            k_memset((_char_t *)pCurSubscribe, 0x0u, sizeof(subscribe_context_t));
+            init_slot_free(INIT_SLOT_SUBSCRIBE, pCurSubscribe);
+            EXIT_CRITICAL_SECTION();
+            return 0u;
         }
-        pCurSubscribe->notify.pData = pData;
-        pCurSubscribe->notify.len = size;
-        pCurSubscribe->notify.muted = false;
-        pCurSubscribe->notify.fn = subscribe_notification;
+    }
+    pCurSubscribe->notify.pData = pData;
+    pCurSubscribe->notify.len = size;
+    pCurSubscribe->notify.muted = false;
+    pCurSubscribe->notify.fn = subscribe_notification;
 
-        EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurSubscribe;
-    };
+    init_name_register(INIT_SLOT_SUBSCRIBE, pCurSubscribe);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurSubscribe;
 }
 
 /**
@@ -322,6 +312,20 @@ _u32_t _impl_publish_init(const _char_t *pName)
     return kernel_privilege_invoke((const void *)_publish_init_privilege_routine, arguments);
 }
 
+/**
+ * @brief Find a publisher id by its name.
+ *
+ * @param pName The publisher name.
+ *
+ * @return The value of publisher unique id.
+ */
+_u32_t _impl_publish_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_PUBLISH, pName);
+}
+
 /**
  * @brief Initialize a new subscribe.
  *
@@ -346,6 +350,20 @@ _u32_t _impl_subscribe_init(void *pDataAddr, _u16_t size, const _char_t *pName)
     return kernel_privilege_invoke((const void *)_subscribe_init_privilege_routine, arguments);
 }
 
+/**
+ * @brief Find a subscriber id by its name.
+ *
+ * @param pName The subscriber name.
+ *
+ * @return The value of subscriber unique id.
+ */
+_u32_t _impl_subscribe_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_SUBSCRIBE, pName);
+}
+
 /**
  * @brief The subscribe register the corresponding publish.
  *
@@ -486,10 +504,13 @@ _i32p_t _impl_publish_data_submit(_u32_t pub_ctx, const void *pPublishData, _u16
  */
 void _impl_publish_pending_handler(void)
 {
-    list_t *pListPending = (list_t *)&g_sp_rsc.callback_list;
+    list_fifo_t *pFifoPending = &g_sp_rsc.callback_fifo;
 
     ENTER_CRITICAL_SECTION();
-    struct subscribe_callback *pCallFuncEntry = (struct subscribe_callback *)list_node_pop(pListPending, LIST_TAIL);
+    struct subscribe_callback *pCallFuncEntry = (struct subscribe_callback *)list_fifo_pop(pFifoPending);
+    if (pCallFuncEntry) {
+        pCallFuncEntry->queued = false;
+    }
     EXIT_CRITICAL_SECTION();
 
     while (pCallFuncEntry) {
@@ -499,7 +520,10 @@ void _impl_publish_pending_handler(void)
         }
 
         ENTER_CRITICAL_SECTION();
-        pCallFuncEntry = (struct subscribe_callback *)list_node_pop(pListPending, LIST_TAIL);
+        pCallFuncEntry = (struct subscribe_callback *)list_fifo_pop(pFifoPending);
+        if (pCallFuncEntry) {
+            pCallFuncEntry->queued = false;
+        }
         EXIT_CRITICAL_SECTION();
     }
 }
@@ -72,6 +72,46 @@ void port_setPendSV(void)
     SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
 }
 
+/**
+ * @brief ARM core waits for the next interrupt in the low power mode.
+ *
+ * It's called in the privilege routine with the PRIMASK set, the pending interrupt can't preempt the running exception to
+ * wake up the WFI, so the core waits for the interrupt pending event instead, and the interrupt is served after return.
+ */
+void port_wait_for_interrupt(void)
+{
+    SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+    __DSB();
+
+    /* Clear the stale event, the interrupt pended before it's checked by the vector pending field */
+    __SEV();
+    __WFE();
+    if (!(SCB->ICSR & SCB_ICSR_VECTPENDING_Msk)) {
+        __WFE();
+    }
+
+    SCB->SCR &= ~SCB_SCR_SEVONPEND_Msk;
+    __ISB();
+}
+
+/**
+ * @brief To check if the FPU context was active in the thread which the exception interrupted.
+ *
+ * @param exc_return The EXC_RETURN value of the exception.
+ *
+ * @return The true indicates the thread used the FPU and the S16 - S31 registers need to save.
+ */
+_b_t port_fpu_context_isActive(_u32_t exc_return)
+{
+#if (__FPU_PRESENT)
+    /* The bit 4 of EXC_RETURN is zero if the extended frame with the FPU registers was stacked */
+    return (exc_return & B(4)) ? false : true;
+#else
+    UNUSED_MSG(exc_return);
+    return false;
+#endif
+}
+
 /**
  * @brief ARM core config kernel thread interrupt priority.
  */
@@ -80,6 +120,14 @@ void port_interrupt_init(void)
     NVIC_SetPriority(PendSV_IRQn, 0xFFu); // Set PendSV to lowest possible priority
     NVIC_SetPriority(SVCall_IRQn, 0u);    // Set SV to lowest possible priority
     NVIC_SetPriority(SysTick_IRQn, 0u);
+
+#if (__FPU_PRESENT)
+    /**
+     * Enable the automatic and lazy FPU state preservation, the extended frame is stacked only for the thread
+     * which has used the FPU, and the S0 - S15 registers are saved only when the handler touches the FPU.
+     */
+    FPU->FPCCR |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk;
+#endif
 }
 
 /**
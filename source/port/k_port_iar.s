@@ -50,6 +50,7 @@ PendSV_Handler:
         PUSH     {R0, R1, R12, LR}
         MOV      R0, SP                                              ; R0 points to the argument ppCurPsp
         ADD      R1, SP, #4                                          ; R1 points to the argument ppNextPSP
+        MOV      R2, LR                                              ; R2 is the argument EXC_RETURN
         BL       kernel_scheduler_inPendSV_c                         ; Call kernel_scheduler_inPendSV_c
         POP      {R0, R1, R12, LR}                                   ; R0 = ppCurPsp, R1 = ppNextPSP
 
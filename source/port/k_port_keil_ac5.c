@@ -13,7 +13,7 @@
 #endif
 
 extern void kernel_privilege_call_inSVC_c(_u32_t *svc_args);
-extern void kernel_scheduler_inPendSV_c(_u32_t **ppCurPsp, _u32_t **ppNextPSP);
+extern void kernel_scheduler_inPendSV_c(_u32_t **ppCurPsp, _u32_t **ppNextPSP, _u32_t exc_return);
 
 /**
  * @brief ARM core SVC interrupt handle function.
@@ -53,6 +53,7 @@ __asm void PendSV_Handler(void)
     PUSH     {R0, R1, R12, LR}
     MOV      R0, SP                                              /* R0 points to the argument ppCurPsp  */
     ADD      R1, SP, #4                                          /* R1 points to the argument ppNextPSP */
+    MOV      R2, LR                                              /* R2 is the argument EXC_RETURN */
     BL       __cpp(kernel_scheduler_inPendSV_c)                  /* Call kernel_scheduler_inPendSV_c */
     POP      {R0, R1, R12, LR}                                   /* R0 = ppCurPsp, R1 = ppNextPSP */
 
@@ -59,6 +59,7 @@ void PendSV_Handler(void)
         "    push     {r0, r1, r12, lr}                     \n"
         "    mov      r0, sp                                \n" /* R0 points to the argument ppCurPsp  */
         "    add      r1, sp, #4                            \n" /* R1 points to the argument ppNextPSP */
+        "    mov      r2, lr                                \n" /* R2 is the argument EXC_RETURN */
         "    bl       kernel_scheduler_inPendSV_c           \n" /* Call kernel_scheduler_inPendSV_c */
         "    pop      {r0, r1, r12, lr}                     \n" /* R0 = ppCurPsp, R1 = ppNextPSP */
         "                                                   \n"
@@ -58,6 +58,24 @@ void port_setPendSV(void)
     /* TODO */
 }
 
+/**
+ * @brief ARM core waits for the next interrupt in the low power mode.
+ */
+void port_wait_for_interrupt(void)
+{
+    /* The host has no interrupt to wait for, it returns to the idle loop to poll again */
+    __asm__ __volatile__("" ::: "memory");
+}
+
+/**
+ * @brief To check if the FPU context was active in the thread which the exception interrupted.
+ */
+b_t port_fpu_context_isActive(u32_t exc_return)
+{
+    /* TODO */
+    return FALSE;
+}
+
 /**
  * @brief ARM core config kernel thread interrupt priority.
  */
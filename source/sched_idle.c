@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "sched_kernel.h"
+#include "sched_timer.h"
+#include "sched_idle.h"
+#include "k_trace.h"
+#include "postcode.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR PC_IER(PC_OS_CMPT_IDLE_12)
+
+/**
+ * Data structure for idle governor
+ */
+typedef struct {
+    /* The registered low power states */
+    const struct idle_state *pState[IDLE_STATE_NUMBER_SUPPORTED];
+
+    /* The residency statistics of each low power state */
+    struct idle_residency residency[IDLE_STATE_NUMBER_SUPPORTED];
+
+    /* The number of the registered low power states */
+    _u8_t number;
+} _idle_resource_t;
+
+/**
+ * Local idle governor resource
+ */
+static _idle_resource_t g_idle_rsc = {0u};
+
+/**
+ * @brief Select the deepest low power state which can pay back its cost in the predicted sleep time.
+ *
+ * @param predict_us The predicted sleep time.
+ *
+ * @return The index of the low power state, the negative value indicates no available state.
+ */
+static _i32_t _idle_state_select(_u32_t predict_us)
+{
+    _i32_t select = -1;
+    _u32_t latency_us = 0u;
+
+    for (_u8_t i = 0u; i < g_idle_rsc.number; i++) {
+        const struct idle_state *pState = g_idle_rsc.pState[i];
+        _u64_t cost_us = (_u64_t)pState->latency_us + pState->residency_us;
+
+        if (cost_us > predict_us) {
+            continue;
+        }
+
+        if ((select < 0) || (pState->latency_us >= latency_us)) {
+            select = (_i32_t)i;
+            latency_us = pState->latency_us;
+        }
+    }
+
+    return select;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _idle_governor_privilege_routine(arguments_t *pArgs)
+{
+    UNUSED_MSG(pArgs);
+
+    /**
+     * The state is selected, entered and accounted in one critical section, so the timer armed before the core sleeps is
+     * included in the predicted time, and the interrupt pended in the meantime still wakes up the core.
+     */
+    ENTER_CRITICAL_SECTION();
+
+    _u32_t predict_us = timer_next_expiry_us_get();
+    _i32_t select = _idle_state_select(predict_us);
+    if (select < 0) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    const struct idle_state *pState = g_idle_rsc.pState[select];
+    _u64_t start_us = clock_time_get();
+    _u32_t sleep_us = 0u;
+
+    if (pState->pEnterFn) {
+        sleep_us = pState->pEnterFn(predict_us);
+    } else {
+        port_wait_for_interrupt();
+    }
+
+    struct idle_residency *pResidency = &g_idle_rsc.residency[select];
+    pResidency->count++;
+    pResidency->total_us += (clock_time_get() - start_us) + sleep_us;
+
+    /* The clock was stopped in the deep low power state, the uncounted time is added back */
+    timer_sleep_compensate(sleep_us);
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _idle_state_register_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    const struct idle_state *pState = (const struct idle_state *)pArgs[0].ptr_val;
+    _i32p_t postcode = PC_EOR;
+
+    if (g_idle_rsc.number < IDLE_STATE_NUMBER_SUPPORTED) {
+        postcode = (_i32p_t)g_idle_rsc.number;
+        g_idle_rsc.pState[g_idle_rsc.number] = pState;
+        k_memset((_u8_t *)&g_idle_rsc.residency[g_idle_rsc.number], 0u, sizeof(struct idle_residency));
+        g_idle_rsc.number++;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _idle_state_residency_get_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    _u8_t index = (_u8_t)pArgs[0].u8_val;
+    struct idle_residency *pResidency = (struct idle_residency *)pArgs[1].pv_val;
+    _i32p_t postcode = PC_EOR;
+
+    if (index < g_idle_rsc.number) {
+        *pResidency = g_idle_rsc.residency[index];
+        postcode = 0;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Register a low power state for the idle governor, the pEnterFn NULL indicates the core WFI state.
+ *
+ * @param pState The pointer of the low power state, it must be kept valid.
+ *
+ * @return The index of the low power state, otherwise is the error postcode.
+ */
+_i32p_t _impl_idle_state_register(const struct idle_state *pState)
+{
+    if (!pState) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.ptr_val = (const void *)pState},
+    };
+
+    return kernel_privilege_invoke((const void *)_idle_state_register_privilege_routine, arguments);
+}
+
+/**
+ * @brief Get the residency statistics of the low power state.
+ *
+ * @param index The index of the low power state.
+ * @param pResidency The pointer of the residency statistics.
+ *
+ * @return The result of the residency get operation.
+ */
+_i32p_t _impl_idle_state_residency_get(_u8_t index, struct idle_residency *pResidency)
+{
+    if (!pResidency) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u8_val = (_u8_t)index},
+        [1] = {.pv_val = (void *)pResidency},
+    };
+
+    return kernel_privilege_invoke((const void *)_idle_state_residency_get_privilege_routine, arguments);
+}
+
+/**
+ * @brief The idle governor enters the low power state based on the next timeout deadline.
+ */
+void idle_governor_run(void)
+{
+    if (!g_idle_rsc.number) {
+        return;
+    }
+
+    kernel_privilege_invoke((const void *)_idle_governor_privilege_routine, NULL);
+}
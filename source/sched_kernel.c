@@ -6,10 +6,12 @@
  **/
 #include "sched_kernel.h"
 #include "sched_timer.h"
+#include "sched_idle.h"
 #include "k_type.h"
 #include "k_trace.h"
 #include "at_rtos.h"
 #include "k_malloc.h"
+#include "k_hook.h"
 #include "postcode.h"
 
 /**
@@ -23,6 +25,8 @@
 typedef struct {
     struct schedule_task *pTask;
 
+    void **ppTls;
+
     _b_t run;
 
     _u32_t pendsv_ms;
@@ -35,7 +39,17 @@ typedef struct {
 
     list_t sch_exit_list;
 
-    list_t sch_wait_list;
+    wait_queue_t sch_wait_list;
+
+    list_t sch_stackless_list;
+
+    struct schedule_task *pStacklessRunner;
+
+    struct stackless_task *pStacklessRun;
+
+#if (SWITCH_HOOK_DYNAMIC_ENABLED)
+    struct switch_hook switch_hook;
+#endif
 } _kernel_resource_t;
 
 /**
@@ -43,8 +57,10 @@ typedef struct {
  */
 static _kernel_resource_t g_kernel_rsc = {
     .pTask = NULL,
+    .ppTls = NULL,
     .run = false,
     .pendsv_ms = 0u,
+    .sch_wait_list = {.order = WAIT_ORDER_FIFO_VAL},
 };
 
 /**
@@ -108,6 +124,72 @@ static void _schedule_transfer_toTargetList(linker_t *pLinker, list_t *pToList)
     EXIT_CRITICAL_SECTION();
 }
 
+/**
+ * @brief Get the tail node of the wait queue, the cached tail is verified before using.
+ *
+ * @param pQueue The pointer of the wait queue.
+ *
+ * @return The pointer of the tail node, the NULL indicates the queue is empty.
+ */
+static list_node_t *_schedule_wait_queue_tail(wait_queue_t *pQueue)
+{
+    list_node_t *pTail = pQueue->pTail;
+
+    /* Only the last node in the queue has no next node */
+    if ((pTail) && (((linker_t *)pTail)->pList == &pQueue->list) && (!pTail->pNext)) {
+        return pTail;
+    }
+
+    pTail = pQueue->list.pHead;
+    while ((pTail) && (pTail->pNext)) {
+        pTail = pTail->pNext;
+    }
+    pQueue->pTail = pTail;
+
+    return pTail;
+}
+
+/**
+ * @brief Push one thread context into the wait queue.
+ *
+ * The thread is appended in constant time when the queue is in the arrival order or it's not higher than the tail one,
+ * the same priority threads are woken up in the arrival order.
+ *
+ * @param pLinker The pointer of the thread linker.
+ * @param pQueue The pointer of the wait queue.
+ */
+static void _schedule_transfer_toWaitQueue(linker_t *pLinker, wait_queue_t *pQueue)
+{
+    ENTER_CRITICAL_SECTION();
+
+    if (pLinker->pList) {
+        list_node_delete(pLinker->pList, &pLinker->node);
+        pLinker->pList = NULL;
+    }
+
+    struct schedule_task *pInTask = (struct schedule_task *)pLinker;
+    list_node_t *pTail = _schedule_wait_queue_tail(pQueue);
+
+    if ((!pTail) || (pQueue->order == WAIT_ORDER_FIFO_VAL) || (((struct schedule_task *)pTail)->prior <= pInTask->prior)) {
+        if (pTail) {
+            pTail->pNext = &pLinker->node;
+        } else {
+            pQueue->list.pHead = &pLinker->node;
+        }
+        pLinker->node.pNext = NULL;
+        pQueue->pTail = &pLinker->node;
+    } else {
+        list_node_t *pFindNode = pQueue->list.pHead;
+        while (((struct schedule_task *)pFindNode)->prior <= pInTask->prior) {
+            pFindNode = pFindNode->pNext;
+        }
+        list_node_insertBefore(&pQueue->list, pFindNode, &pLinker->node);
+    }
+    pLinker->pList = &pQueue->list;
+
+    EXIT_CRITICAL_SECTION();
+}
+
 static void _schedule_transfer_toExitList(linker_t *pLinker)
 {
     ENTER_CRITICAL_SECTION();
@@ -118,10 +200,31 @@ static void _schedule_transfer_toExitList(linker_t *pLinker)
     EXIT_CRITICAL_SECTION();
 }
 
+/**
+ * @brief Wake up the stackless runner thread if it's waiting for the ready stackless task.
+ */
+static void _schedule_stackless_runner_wakeup(void)
+{
+    struct schedule_task *pRunner = g_kernel_rsc.pStacklessRunner;
+
+    if ((pRunner) && (pRunner->linker.pList == &g_kernel_rsc.sch_wait_list.list)) {
+        schedule_entry_trigger(pRunner, NULL, 0u);
+    }
+}
+
 static void _schedule_transfer_toPendList(linker_t *pLinker)
 {
     ENTER_CRITICAL_SECTION();
 
+    if (((struct schedule_task *)pLinker)->stackless) {
+        /* The stackless task is resumed by the runner thread rather than the scheduler */
+        linker_list_transaction_common(pLinker, (list_t *)&g_kernel_rsc.sch_stackless_list, LIST_TAIL);
+        _schedule_stackless_runner_wakeup();
+
+        EXIT_CRITICAL_SECTION();
+        return;
+    }
+
     list_t *pToList = (list_t *)&g_kernel_rsc.sch_pend_list;
     linker_list_transaction_specific(pLinker, pToList, _schedule_priority_node_order_compare_condition);
 
@@ -157,8 +260,8 @@ static void _schedule_exit(_u32_t ms)
                 need = true;
             }
         }
-        if (pExit->pToList) {
-            _schedule_transfer_toTargetList((linker_t *)&pCurTask->linker, (list_t *)pExit->pToList);
+        if (pExit->pToQueue) {
+            _schedule_transfer_toWaitQueue((linker_t *)&pCurTask->linker, pExit->pToQueue);
         } else {
             thread_context_t *pDelThread = (thread_context_t *)CONTAINEROF(pCurTask, thread_context_t, task);
 
@@ -168,7 +271,9 @@ static void _schedule_exit(_u32_t ms)
             } else {
                 k_memset((_char_t *)pDelThread->pStackAddr, STACT_UNUSED_DATA, pDelThread->stackSize);
             }
+            init_name_unregister(INIT_SLOT_THREAD, pDelThread);
             k_memset((_char_t *)pDelThread, 0x0u, sizeof(thread_context_t));
+            init_slot_free(INIT_SLOT_THREAD, pDelThread);
         }
 
         k_memset(pExit, 0x0, sizeof(struct call_exit));
@@ -193,6 +298,10 @@ static void _schedule_entry(_u32_t ms)
             pEntry->fun(pCurTask);
             pEntry->fun = NULL;
         }
+        if (pCurTask->linker.pList != pList) {
+            /* The entry callback parked it into another blocking list */
+            continue;
+        }
         pCurTask->pPendCtx = NULL;
         pCurTask->exec.analyze.last_pend_ms = ms;
 
@@ -200,26 +309,60 @@ static void _schedule_entry(_u32_t ms)
     }
 }
 
-_i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, list_t *pToList, _u32_t timeout_ms,
+/**
+ * @brief Get the wait queue of the list that the task stays in.
+ *
+ * @param pList The pointer of the list.
+ *
+ * @return The pointer of the wait queue, NULL is a scheduler list.
+ */
+static wait_queue_t *_schedule_wait_queue_get(list_t *pList)
+{
+    if ((!pList) || (pList == &g_kernel_rsc.sch_pend_list) || (pList == &g_kernel_rsc.sch_exit_list) ||
+        (pList == &g_kernel_rsc.sch_entry_list) || (pList == &g_kernel_rsc.sch_stackless_list)) {
+        return NULL;
+    }
+
+    return (wait_queue_t *)CONTAINEROF(pList, wait_queue_t, list);
+}
+
+/**
+ * @brief Let the wait queue owner re-check its blocking threads, the task left or was repositioned without its wakeup.
+ *
+ * @param pQueue The pointer of the wait queue.
+ */
+static void _schedule_wait_queue_refresh(wait_queue_t *pQueue)
+{
+    if ((pQueue) && (pQueue->pRefreshFunc)) {
+        pQueue->pRefreshFunc(pQueue);
+    }
+}
+
+_i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, wait_queue_t *pToQueue, _u32_t timeout_ms,
                               _b_t immediately)
 {
+    wait_queue_t *pFromQueue = _schedule_wait_queue_get((list_t *)pTask->linker.pList);
     pTask->pPendCtx = pHoldCtx;
     pTask->pPendData = pHoldData;
 
     if (immediately) {
         timeout_set(&pTask->expire, timeout_ms, true);
-        if (pToList) {
-            _schedule_transfer_toTargetList((linker_t *)&pTask->linker, pToList);
+        if (pToQueue) {
+            _schedule_transfer_toWaitQueue((linker_t *)&pTask->linker, pToQueue);
         } else {
-            pTask->exec.exit.pToList = pToList;
+            pTask->exec.exit.pToQueue = pToQueue;
             pTask->exec.exit.timeout_ms = timeout_ms;
             _schedule_transfer_toExitList((linker_t *)&pTask->linker);
         }
     } else {
-        pTask->exec.exit.pToList = pToList;
+        pTask->exec.exit.pToQueue = pToQueue;
         pTask->exec.exit.timeout_ms = timeout_ms;
         _schedule_transfer_toExitList((linker_t *)&pTask->linker);
     }
+
+    if (pFromQueue != pToQueue) {
+        _schedule_wait_queue_refresh(pFromQueue);
+    }
     return kernel_thread_schedule_request();
 }
 
@@ -227,14 +370,115 @@ _i32p_t schedule_entry_trigger(struct schedule_task *pTask, pTask_callbackFunc_t
 {
     pTask->exec.entry.result = result;
     pTask->exec.entry.fun = callback;
-    _schedule_transfer_toEntryList((linker_t *)&pTask->linker);
+
+    if (callback) {
+        /* The callback has to be deferred into the PendSV context */
+        _schedule_transfer_toEntryList((linker_t *)&pTask->linker);
+    } else {
+        /* Nothing to defer, the thread moves onto the pending list directly */
+        pTask->pPendCtx = NULL;
+        pTask->exec.analyze.last_pend_ms = timer_total_system_ms_get();
+        _schedule_transfer_toPendList((linker_t *)&pTask->linker);
+    }
     return kernel_thread_schedule_request();
 }
 
+void schedule_entry_redirect(struct schedule_task *pTask, void *pHoldCtx, wait_queue_t *pToQueue)
+{
+    pTask->pPendCtx = pHoldCtx;
+    _schedule_transfer_toWaitQueue((linker_t *)&pTask->linker, pToQueue);
+}
+
+void schedule_priority_set(struct schedule_task *pTask, _i16_t prior)
+{
+    ENTER_CRITICAL_SECTION();
+
+    pTask->prior = prior;
+
+    /**
+     * The entry list is drained in the PendSV by the arrival order, the pending and exit lists are priority-ordered,
+     * and the others lists that a thread stays in are the wait queues, so the thread has to be repositioned in place.
+     */
+    list_t *pList = (list_t *)pTask->linker.pList;
+    wait_queue_t *pQueue = _schedule_wait_queue_get(pList);
+    if ((pList == &g_kernel_rsc.sch_pend_list) || (pList == &g_kernel_rsc.sch_exit_list)) {
+        _schedule_transfer_toTargetList((linker_t *)&pTask->linker, pList);
+    } else if ((pQueue) && (pQueue->order == WAIT_ORDER_PRIORITY_VAL)) {
+        _schedule_transfer_toWaitQueue((linker_t *)&pTask->linker, pQueue);
+        _schedule_wait_queue_refresh(pQueue);
+    }
+
+    EXIT_CRITICAL_SECTION();
+}
+
+/**
+ * @brief Get the highest priority of the tasks blocking in the wait queue.
+ *
+ * @param pQueue The pointer of the wait queue.
+ * @param prior The priority to be compared.
+ *
+ * @return The higher one of the compared priority and the blocking tasks priority.
+ */
+static _i16_t _schedule_priority_blocking_get(wait_queue_t *pQueue, _i16_t prior)
+{
+    struct schedule_task *pCurTask = NULL;
+    list_iterator_t it = ITERATION_NULL;
+    list_iterator_init(&it, &pQueue->list);
+    while (list_iterator_next_condition(&it, (void *)&pCurTask)) {
+        if (pCurTask->prior < prior) {
+            prior = pCurTask->prior;
+        }
+    }
+    return prior;
+}
+
+void schedule_priority_recover(struct schedule_task *pTask)
+{
+    if (pTask->prior == pTask->basePrior) {
+        /* Nothing was inherited, the base priority is the lowest one it can be recovered to */
+        return;
+    }
+
+    ENTER_CRITICAL_SECTION();
+
+    /* The effective priority is the higher one of the base priority and the blocking tasks of the locks it still holds */
+    _i16_t prior = pTask->basePrior;
+    list_node_t *pNode = NULL;
+    list_iterator_t it = ITERATION_NULL;
+    list_iterator_init(&it, &pTask->holdList);
+    while (list_iterator_next_condition(&it, &pNode)) {
+        struct lock_hold *pHold = (struct lock_hold *)CONTAINEROF(pNode, struct lock_hold, node);
+        for (_u8_t i = 0u; i < DIMOF(pHold->pQueue); i++) {
+            if (pHold->pQueue[i]) {
+                prior = _schedule_priority_blocking_get(pHold->pQueue[i], prior);
+            }
+        }
+    }
+
+    if (prior != pTask->prior) {
+        schedule_priority_set(pTask, prior);
+    }
+
+    EXIT_CRITICAL_SECTION();
+}
+
+void schedule_lock_hold(struct schedule_task *pTask, struct lock_hold *pHold)
+{
+    list_node_push(&pTask->holdList, &pHold->node, LIST_HEAD);
+}
+
+void schedule_lock_release(struct schedule_task *pTask, struct lock_hold *pHold)
+{
+    list_node_delete(&pTask->holdList, &pHold->node);
+    schedule_priority_recover(pTask);
+}
+
 void schedule_callback_fromTimeOut(void *pNode)
 {
     struct schedule_task *pCurTask = (struct schedule_task *)CONTAINEROF(pNode, struct schedule_task, expire);
+    wait_queue_t *pFromQueue = _schedule_wait_queue_get((list_t *)pCurTask->linker.pList);
     schedule_entry_trigger(pCurTask, NULL, PC_OS_WAIT_TIMEOUT);
+    _schedule_wait_queue_refresh(pFromQueue);
 }
 
 _b_t schedule_hasTwoPendingItem(void)
@@ -259,9 +503,60 @@ void schedule_setPend(struct schedule_task *pTask)
     EXIT_CRITICAL_SECTION();
 }
 
-list_t *schedule_waitList(void)
+wait_queue_t *schedule_waitList(void)
+{
+    return (wait_queue_t *)&g_kernel_rsc.sch_wait_list;
+}
+
+/**
+ * @brief Register the runner thread of the stackless tasks.
+ *
+ * @param pRunner The pointer of the runner thread task.
+ */
+void schedule_stackless_runner_set(struct schedule_task *pRunner)
+{
+    g_kernel_rsc.pStacklessRunner = pRunner;
+}
+
+/**
+ * @brief Put a stackless task into the ready list of the runner thread.
+ *
+ * @param pTask The pointer of the stackless task.
+ */
+void schedule_stackless_ready(struct schedule_task *pTask)
+{
+    pTask->pPendCtx = NULL;
+    _schedule_transfer_toPendList((linker_t *)&pTask->linker);
+}
+
+/**
+ * @brief Take the first ready stackless task, the runner thread waits when there is nothing to run.
+ *
+ * @return The pointer of the ready stackless task, the NULL indicates the runner thread is going to wait.
+ */
+struct stackless_task *schedule_stackless_take(void)
+{
+    struct schedule_task *pTask = (struct schedule_task *)g_kernel_rsc.sch_stackless_list.pHead;
+
+    if (!pTask) {
+        schedule_exit_trigger(g_kernel_rsc.pStacklessRunner, NULL, NULL, schedule_waitList(), OS_TIME_FOREVER_VAL, true);
+        return NULL;
+    }
+
+    _schedule_transfer_toNullList((linker_t *)&pTask->linker);
+    return (struct stackless_task *)CONTAINEROF(pTask, struct stackless_task, task);
+}
+
+_b_t schedule_wait_order_set(wait_queue_t *pQueue, _u8_t order)
 {
-    return (list_t *)&g_kernel_rsc.sch_wait_list;
+    if (pQueue->list.pHead) {
+        /* The blocking threads were queued in the previous order */
+        return false;
+    }
+
+    pQueue->order = order;
+    pQueue->pTail = NULL;
+    return true;
 }
 
 _b_t _schedule_can_preempt(struct schedule_task *pCurrent)
@@ -297,8 +592,9 @@ _b_t _schedule_can_preempt(struct schedule_task *pCurrent)
  *
  * @param ppCurThreadPsp The current thread psp address.
  * @param ppNextThreadPSP The next thread psp address.
+ * @param exc_return The EXC_RETURN value of the PendSV exception.
  */
-void kernel_scheduler_inPendSV_c(_u32_t **ppCurPsp, _u32_t **ppNextPSP)
+void kernel_scheduler_inPendSV_c(_u32_t **ppCurPsp, _u32_t **ppNextPSP, _u32_t exc_return)
 {
     _u32_t ms = timer_total_system_ms_get();
 
@@ -312,8 +608,16 @@ void kernel_scheduler_inPendSV_c(_u32_t **ppCurPsp, _u32_t **ppNextPSP)
         *ppCurPsp = (_u32_t *)&pCurrent->psp;
         *ppNextPSP = (_u32_t *)&pNext->psp;
 
+        if (port_fpu_context_isActive(exc_return)) {
+            /* The PendSV saves the S16 - S31 registers only for the thread which has used the FPU */
+            pCurrent->exec.analyze.fpu_switch++;
+        }
+
         _schedule_time_analyze(pCurrent, pNext, ms);
+        KERNEL_SWITCH_HOOK_INVOKE(&g_kernel_rsc.switch_hook, (_u32_t)CONTAINEROF(pCurrent, thread_context_t, task),
+                                  (_u32_t)CONTAINEROF(pNext, thread_context_t, task));
         g_kernel_rsc.pTask = pNext;
+        g_kernel_rsc.ppTls = ((thread_context_t *)CONTAINEROF(pNext, thread_context_t, task))->tls;
         g_kernel_rsc.pendsv_ms = ms;
     } else {
         *ppCurPsp = (_u32_t *)&pCurrent->psp;
@@ -339,6 +643,107 @@ static _b_t _kernel_isInPrivilegeMode(void)
     return port_isInInterruptContent();
 }
 
+/**
+ * @brief Replay one recorded kernel operation with its copied arguments.
+ *
+ * @param pOper The pointer of the recorded operation.
+ *
+ * @return The result of the kernel operation.
+ */
+static _i32p_t _kernel_transaction_operation_run(struct transaction_operation *pOper)
+{
+    extern _i32p_t _impl_semaphore_give(_u32_t ctx);
+    extern _i32p_t _impl_event_set(_u32_t ctx, _u64_t set, _u64_t clear, _u64_t toggle);
+    extern _i32p_t _impl_queue_send(_u32_t ctx, const _u8_t *pUserBuffer, _u16_t bufferSize, _b_t isToFront, _u32_t timeout_ms);
+
+    switch (pOper->type) {
+    case TRANSACTION_OPER_SEM_GIVE_VAL:
+        return _impl_semaphore_give(pOper->ctx);
+    case TRANSACTION_OPER_EVT_SET_VAL:
+        return _impl_event_set(pOper->ctx, pOper->arg.evt.set, pOper->arg.evt.clear, pOper->arg.evt.toggle);
+    case TRANSACTION_OPER_MSGQ_PUT_VAL:
+        return _impl_queue_send(pOper->ctx, pOper->arg.msgq.pUserBuffer, pOper->arg.msgq.size, pOper->arg.msgq.isToFront,
+                                OS_TIME_NOWAIT_VAL);
+    default:
+        break;
+    }
+    return PC_EOR;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _kernel_transaction_commit_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    struct kernel_transaction *pTrans = (struct kernel_transaction *)pArgs[0].pv_val;
+    _i32p_t postcode = 0;
+
+    /**
+     * Only the recorded kernel operations are replayed, no user code runs here. They're called directly in the privilege mode
+     * without the svc trap, none of them blocks, and the PendSV is taken only once after all operations completed.
+     */
+    for (_u8_t i = 0u; i < pTrans->number; i++) {
+        struct transaction_operation *pOper = &pTrans->operation[i];
+
+        pOper->result = _kernel_transaction_operation_run(pOper);
+        if ((pOper->result < 0) && (postcode >= 0)) {
+            postcode = pOper->result;
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+#if (SWITCH_HOOK_DYNAMIC_ENABLED)
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _kernel_switch_hook_register_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    g_kernel_rsc.switch_hook.pOutFunc = (pSwitch_hookFunc_t)pArgs[0].ptr_val;
+    g_kernel_rsc.switch_hook.pInFunc = (pSwitch_hookFunc_t)pArgs[1].ptr_val;
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+#endif
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _u32_t _kernel_name_toId_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    _u8_t type = (_u8_t)pArgs[0].u8_val;
+    const _char_t *pName = (const _char_t *)pArgs[1].pch_val;
+
+    _u32_t id = (_u32_t)init_name_lookup(type, pName);
+    if (!id) {
+        id = OS_INVALID_ID_VAL;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return id;
+}
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -357,6 +762,7 @@ static _i32p_t _kernel_start_privilege_routine(arguments_t *pArgs)
     clock_time_init(timeout_handler);
 
     g_kernel_rsc.pTask = _schedule_nextTaskGet();
+    g_kernel_rsc.ppTls = kernel_thread_runContextGet()->tls;
     g_kernel_rsc.run = true;
 
     EXIT_CRITICAL_SECTION();
@@ -399,6 +805,54 @@ thread_context_t *kernel_thread_runContextGet(void)
     return (thread_context_t *)CONTAINEROF(g_kernel_rsc.pTask, thread_context_t, task);
 }
 
+/**
+ * @brief Set the stackless task which is running in the runner thread.
+ *
+ * @param pStackless The pointer of the running stackless task, the NULL indicates it returned.
+ */
+void kernel_stackless_runSet(struct stackless_task *pStackless)
+{
+    g_kernel_rsc.pStacklessRun = pStackless;
+}
+
+/**
+ * @brief Get the stackless task which is running in the current thread.
+ *
+ * @return The pointer of the running stackless task, the NULL indicates the current thread is not running any of them.
+ */
+struct stackless_task *kernel_stackless_runGet(void)
+{
+    if ((!g_kernel_rsc.pStacklessRun) || (g_kernel_rsc.pTask != g_kernel_rsc.pStacklessRunner)) {
+        return NULL;
+    }
+    return g_kernel_rsc.pStacklessRun;
+}
+
+/**
+ * @brief Get the waiting task of the current context, it's the running stackless task or the current running thread.
+ *
+ * @return The pointer of the task which is going to wait.
+ */
+struct schedule_task *kernel_task_runGet(void)
+{
+    struct stackless_task *pStackless = kernel_stackless_runGet();
+
+    return (pStackless) ? (&pStackless->task) : (g_kernel_rsc.pTask);
+}
+
+/**
+ * @brief Get the thread local storage slots of the current running thread.
+ *
+ * The pointer is updated together with the running thread at the context switch,
+ * so it can be read in the thread mode without the kernel trap.
+ *
+ * @return The slots pointer of current running thread, NULL is the kernel not running.
+ */
+void **kernel_thread_tlsGet(void)
+{
+    return g_kernel_rsc.ppTls;
+}
+
 /**
  * @brief Read and clean the current running thread schedule entry result.
  *
@@ -472,6 +926,8 @@ void kernel_idle_thread(void *p_arg)
 {
     while (1) {
         kthread_message_idle_loop_fn();
+
+        idle_governor_run();
     }
 }
 
@@ -545,6 +1001,121 @@ _i32p_t _impl_kernel_at_rtos_run(void)
     return kernel_privilege_invoke((const void *)_kernel_start_privilege_routine, NULL);
 }
 
+/**
+ * @brief Reset the kernel transaction to record the new operations.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ *
+ * @return The result of the transaction init operation.
+ */
+_i32p_t _impl_kernel_transaction_init(struct kernel_transaction *pTrans)
+{
+    if (!pTrans) {
+        return PC_EOR;
+    }
+
+    k_memset((_char_t *)pTrans, 0x0u, sizeof(struct kernel_transaction));
+    return 0;
+}
+
+/**
+ * @brief Record one kernel operation into the kernel transaction, its arguments are copied.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ * @param pOper The pointer of the kernel operation.
+ *
+ * @return The result of the transaction add operation.
+ */
+_i32p_t _impl_kernel_transaction_add(struct kernel_transaction *pTrans, const struct transaction_operation *pOper)
+{
+    if ((!pTrans) || (!pOper)) {
+        return PC_EOR;
+    }
+
+    if (pOper->type >= TRANSACTION_OPER_NUMBER) {
+        return PC_EOR;
+    }
+
+    if ((pOper->type == TRANSACTION_OPER_MSGQ_PUT_VAL) && (!pOper->arg.msgq.pUserBuffer)) {
+        return PC_EOR;
+    }
+
+    if (pTrans->number >= TRANSACTION_OPERATION_NUMBER_SUPPORTED) {
+        return PC_EOR;
+    }
+
+    struct transaction_operation *pRecord = &pTrans->operation[pTrans->number++];
+    *pRecord = *pOper;
+    pRecord->result = PC_EOR;
+    return 0;
+}
+
+/**
+ * @brief Execute all recorded operations in one privileged entry.
+ *
+ * @param pTrans The pointer of the kernel transaction.
+ *
+ * @return The first failed operation result, otherwise return 0.
+ */
+_i32p_t _impl_kernel_transaction_commit(struct kernel_transaction *pTrans)
+{
+    if (!pTrans) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)pTrans},
+    };
+
+    return kernel_privilege_invoke((const void *)_kernel_transaction_commit_privilege_routine, arguments);
+}
+
+/**
+ * @brief Register the context switch hooks at runtime, the NULL hook is removed.
+ *
+ * @param pOutFunc The hook function of the switching out thread.
+ * @param pInFunc The hook function of the switching in thread.
+ *
+ * @return The result of the hook register operation.
+ */
+_i32p_t _impl_kernel_switch_hook_register(pSwitch_hookFunc_t pOutFunc, pSwitch_hookFunc_t pInFunc)
+{
+#if (SWITCH_HOOK_DYNAMIC_ENABLED)
+    arguments_t arguments[] = {
+        [0] = {.ptr_val = (const void *)pOutFunc},
+        [1] = {.ptr_val = (const void *)pInFunc},
+    };
+
+    return kernel_privilege_invoke((const void *)_kernel_switch_hook_register_privilege_routine, arguments);
+#else
+    UNUSED_MSG(pOutFunc);
+    UNUSED_MSG(pInFunc);
+    return PC_EOR;
+#endif
+}
+
+/**
+ * @brief Find the kernel object id by its name through the name hash index.
+ *
+ * @param type The kernel object type.
+ * @param pName The object name.
+ *
+ * @return The value of object unique id.
+ */
+_u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName)
+{
+    if ((!pName) || (type >= INIT_SLOT_NUM)) {
+        return OS_INVALID_ID_VAL;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u8_val = (_u8_t)type},
+        [1] = {.pch_val = (const void *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_kernel_name_toId_privilege_routine, arguments);
+}
+
 /**
  * @brief Disable kernel hardware irq.
  */
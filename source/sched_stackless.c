@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "sched_kernel.h"
+#include "sched_timer.h"
+#include "k_trace.h"
+#include "postcode.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR PC_IER(PC_OS_CMPT_STACKLESS_13)
+
+#if (STACKLESS_TASK_ENABLED)
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _stackless_ready_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    struct stackless_task *pStackless = (struct stackless_task *)pArgs[0].pv_val;
+
+    schedule_stackless_ready(&pStackless->task);
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _stackless_runner_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    schedule_stackless_runner_set((struct schedule_task *)pArgs[0].pv_val);
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _stackless_take_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    pArgs[0].pv_val = (void *)schedule_stackless_take();
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief The runner thread resumes the ready stackless tasks one by one on its own stack.
+ *
+ * @param p_arg The thread argument.
+ */
+void kernel_stackless_thread(void *p_arg)
+{
+    UNUSED_MSG(p_arg);
+
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)&kernel_thread_runContextGet()->task},
+    };
+    kernel_privilege_invoke((const void *)_stackless_runner_set_privilege_routine, arguments);
+
+    while (1) {
+        arguments[0].pv_val = NULL;
+        kernel_privilege_invoke((const void *)_stackless_take_privilege_routine, arguments);
+
+        struct stackless_task *pStackless = (struct stackless_task *)arguments[0].pv_val;
+        if (!pStackless) {
+            /* Nothing is ready, the runner thread was parked until a stackless task is ready */
+            continue;
+        }
+
+        kernel_stackless_runSet(pStackless);
+        _u8_t state = pStackless->pEntryFunc(pStackless, pStackless->pArg);
+        kernel_stackless_runSet(NULL);
+
+        if (state == STACKLESS_STATE_YIELD_VAL) {
+            kernel_privilege_invoke((const void *)_stackless_ready_privilege_routine, arguments);
+        }
+        /* The waiting task is readied by its wakeup, and the exited task is never resumed again */
+    }
+}
+#endif
+
+/**
+ * @brief Initialize a stackless task and make it ready to the runner thread.
+ *
+ * @param pStackless The pointer of the stackless task.
+ * @param pEntryFunc The stackless task entry function.
+ * @param pArg The stackless task entry argument.
+ * @param priority The priority to order the stackless task in the wait queues.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_stackless_init(struct stackless_task *pStackless, pStackless_entryFunc_t pEntryFunc, void *pArg, _i16_t priority)
+{
+#if (STACKLESS_TASK_ENABLED)
+    if ((!pStackless) || (!pEntryFunc)) {
+        return PC_EOR;
+    }
+
+    if (priority > 0xFF) {
+        return PC_EOR;
+    }
+
+    if (pStackless->task.linker.pList) {
+        return PC_EOR;
+    }
+
+    k_memset((_char_t *)pStackless, 0x0u, sizeof(struct stackless_task));
+    pStackless->task.stackless = true;
+    pStackless->task.prior = priority;
+    pStackless->task.basePrior = priority;
+    pStackless->pEntryFunc = pEntryFunc;
+    pStackless->pArg = pArg;
+    timeout_init(&pStackless->task.expire, schedule_callback_fromTimeOut);
+
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)pStackless},
+    };
+    return kernel_privilege_invoke((const void *)_stackless_ready_privilege_routine, arguments);
+#else
+    UNUSED_MSG(pStackless);
+    UNUSED_MSG(pEntryFunc);
+    UNUSED_MSG(pArg);
+    UNUSED_MSG(priority);
+
+    return PC_EOR;
+#endif
+}
+
+/**
+ * @brief Take the wakeup result of the stackless task after it's resumed from the wait.
+ *
+ * @param pStackless The pointer of the stackless task.
+ *
+ * @return The result of the wait operation.
+ */
+_i32p_t _impl_stackless_result_take(struct stackless_task *pStackless)
+{
+    if (!pStackless) {
+        return PC_EOR;
+    }
+
+    ENTER_CRITICAL_SECTION();
+
+    pStackless->result = (_i32p_t)pStackless->task.exec.entry.result;
+    pStackless->task.exec.entry.result = PC_EOR;
+
+    EXIT_CRITICAL_SECTION();
+
+    return pStackless->result;
+}
@@ -61,42 +61,39 @@ static _u32_t _thread_init_privilege_routine(arguments_t *pArgs)
     void *p_arg = (void *)pArgs[4].pv_val;
     const _char_t *pName = (const _char_t *)pArgs[5].pch_val;
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
-    {
-        if (_thread_context_isInvalid(pCurThread)) {
-            break;
-        }
-
-        if (_thread_context_isInit(pCurThread)) {
-            continue;
-        }
+    thread_context_t *pCurThread = (thread_context_t *)init_slot_alloc(INIT_SLOT_THREAD);
+    if (!pCurThread) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        k_memset((_char_t *)pCurThread, 0x0u, sizeof(thread_context_t));
-        pCurThread->head.cs = CS_INITED;
-        pCurThread->head.pName = pName;
+    k_memset((_char_t *)pCurThread, 0x0u, sizeof(thread_context_t));
+    pCurThread->head.cs = CS_INITED;
+    pCurThread->head.pName = pName;
 
-        pCurThread->pEntryFunc = pEntryFun;
+    pCurThread->pEntryFunc = pEntryFun;
+    if (!pAddress) {
+        pAddress = (_u32_t *)k_malloc(size);
         if (!pAddress) {
-            pAddress = (_u32_t *)k_malloc(size);
-            if (!pAddress) {
-                EXIT_CRITICAL_SECTION();
-                return 0u;
-            }
+            k_memset((_char_t *)pCurThread, 0x0u, sizeof(thread_context_t));
+            init_slot_free(INIT_SLOT_THREAD, pCurThread);
+            EXIT_CRITICAL_SECTION();
+            return 0u;
         }
-        pCurThread->pStackAddr = pAddress;
-        pCurThread->stackSize = size;
+    }
+    pCurThread->pStackAddr = pAddress;
+    pCurThread->stackSize = size;
 
-        pCurThread->task.prior = priority;
-        pCurThread->task.psp = (_u32_t)kernel_stack_frame_init(pEntryFun, pAddress, size, p_arg);
-        timeout_init(&pCurThread->task.expire, schedule_callback_fromTimeOut);
-        schedule_setPend(&pCurThread->task);
+    pCurThread->task.prior = priority;
+    pCurThread->task.basePrior = priority;
+    pCurThread->task.psp = (_u32_t)kernel_stack_frame_init(pEntryFun, pAddress, size, p_arg);
+    timeout_init(&pCurThread->task.expire, schedule_callback_fromTimeOut);
+    schedule_setPend(&pCurThread->task);
 
-        EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurThread;
-    }
+    init_name_register(INIT_SLOT_THREAD, pCurThread);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurThread;
 }
 
 /**
@@ -106,30 +103,17 @@ static _u32_t _thread_init_privilege_routine(arguments_t *pArgs)
  *
  * @return The result of privilege routine.
  */
-static _u32_t _thread_name_toId_privilege_routine(arguments_t *pArgs)
+static _u32_t _thread_stack_free_get_privilege_routine(arguments_t *pArgs)
 {
     ENTER_CRITICAL_SECTION();
 
-    const _char_t *pName = (const _char_t *)pArgs[0].pch_val;
-
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
-    {
-        if (_thread_context_isInvalid(pCurThread)) {
-            break;
-        }
-
-        if (!_thread_context_isInit(pCurThread)) {
-            continue;
-        }
+    thread_context_t *pCurThread = (thread_context_t *)pArgs[0].u32_val;
 
-        if (k_memcmp(pCurThread->head.pName, pName, sizeof(pCurThread->head.pName))) {
-            EXIT_CRITICAL_SECTION();
-            return (_u32_t)pCurThread;
-        }
-    }
+    _u32_t free = port_stack_free_size_get(*pCurThread->pStackAddr);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+
+    return free;
 }
 
 /**
@@ -139,17 +123,16 @@ static _u32_t _thread_name_toId_privilege_routine(arguments_t *pArgs)
  *
  * @return The result of privilege routine.
  */
-static _u32_t _thread_stack_free_get_privilege_routine(arguments_t *pArgs)
+static _i32p_t _thread_user_data_register_privilege_routine(arguments_t *pArgs)
 {
     ENTER_CRITICAL_SECTION();
-
     thread_context_t *pCurThread = (thread_context_t *)pArgs[0].u32_val;
+    void *pData = (void *)pArgs[1].pv_val;
 
-    _u32_t free = port_stack_free_size_get(*pCurThread->pStackAddr);
+    pCurThread->pUserData = pData;
 
     EXIT_CRITICAL_SECTION();
-
-    return free;
+    return 0;
 }
 
 /**
@@ -159,16 +142,25 @@ static _u32_t _thread_stack_free_get_privilege_routine(arguments_t *pArgs)
  *
  * @return The result of privilege routine.
  */
-static _i32p_t _thread_user_data_register_privilege_routine(arguments_t *pArgs)
+static _u32_t _thread_user_data_get_privilege_routine(arguments_t *pArgs)
 {
-    ENTER_CRITICAL_SECTION();
     thread_context_t *pCurThread = (thread_context_t *)pArgs[0].u32_val;
-    void *pData = (void *)pArgs[1].pv_val;
 
-    pCurThread->pUserData = pData;
+    return (_u32_t)pCurThread->pUserData;
+}
 
-    EXIT_CRITICAL_SECTION();
-    return 0;
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _u32_t _thread_fpu_switch_get_privilege_routine(arguments_t *pArgs)
+{
+    thread_context_t *pCurThread = (thread_context_t *)pArgs[0].u32_val;
+
+    return pCurThread->task.exec.analyze.fpu_switch;
 }
 
 /**
@@ -178,11 +170,26 @@ static _i32p_t _thread_user_data_register_privilege_routine(arguments_t *pArgs)
  *
  * @return The result of privilege routine.
  */
-static _u32_t _thread_user_data_get_privilege_routine(arguments_t *pArgs)
+static _i32p_t _thread_priority_set_privilege_routine(arguments_t *pArgs)
 {
+    ENTER_CRITICAL_SECTION();
+
     thread_context_t *pCurThread = (thread_context_t *)pArgs[0].u32_val;
+    _i16_t priority = (_i16_t)pArgs[1].u16_val;
+    _i32p_t postcode = 0;
 
-    return (_u32_t)pCurThread->pUserData;
+    _i16_t prior = pCurThread->task.prior;
+
+    /* The effective priority is recomputed from the new base, the inherited priority is kept until the thread unlocks */
+    pCurThread->task.basePrior = priority;
+    schedule_priority_recover(&pCurThread->task);
+
+    if (pCurThread->task.prior != prior) {
+        postcode = kernel_thread_schedule_request();
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
 }
 
 /**
@@ -289,11 +296,9 @@ static _i32p_t _thread_sleep_privilege_routine(arguments_t *pArgs)
 {
     ENTER_CRITICAL_SECTION();
     _u32_t timeout_ms = (_u32_t)pArgs[0].u32_val;
-    thread_context_t *pCurThread = NULL;
     _i32p_t postcode = PC_EOR;
 
-    pCurThread = kernel_thread_runContextGet();
-    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), timeout_ms, true);
+    postcode = schedule_exit_trigger(kernel_task_runGet(), NULL, NULL, schedule_waitList(), timeout_ms, true);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -369,7 +374,7 @@ _u32_t _impl_thread_init(pThread_entryFunc_t pEntryFun, _u32_t *pAddress, _u32_t
 }
 
 /**
- * @brief Initialize a new thread.
+ * @brief Find a thread id by its name.
  *
  * @param pName The thread name.
  *
@@ -377,15 +382,9 @@ _u32_t _impl_thread_init(pThread_entryFunc_t pEntryFun, _u32_t *pAddress, _u32_t
  */
 _u32_t _impl_thread_name_toId(const _char_t *pName)
 {
-    if (!pName) {
-        return OS_INVALID_ID_VAL;
-    }
-
-    arguments_t arguments[] = {
-        [0] = {.pch_val = (const void *)pName},
-    };
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
 
-    return kernel_privilege_invoke((const void *)_thread_name_toId_privilege_routine, arguments);
+    return _impl_kernel_name_toId(INIT_SLOT_THREAD, pName);
 }
 
 /**
@@ -464,6 +463,139 @@ void *_impl_thread_user_data_get(_u32_t ctx)
     return (void *)kernel_privilege_invoke((const void *)_thread_user_data_get_privilege_routine, arguments);
 }
 
+/**
+ * @brief Set a thread local storage slot value of the current running thread.
+ *
+ * @param slot The slot index.
+ * @param pValue The slot value.
+ *
+ * @return The result of thread local storage operation.
+ */
+_i32p_t _impl_thread_tls_set(_u8_t slot, void *pValue)
+{
+    /* The interrupt handler has no own slots, the slots of the interrupted thread aren't touched */
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    void **ppTls = kernel_thread_tlsGet();
+    if ((!ppTls) || (slot >= THREAD_TLS_SLOT_NUMBER)) {
+        return PC_EOR;
+    }
+
+    /* Only the running thread writes its own slots, the aligned pointer store is atomic */
+    ppTls[slot] = pValue;
+    return 0;
+}
+
+/**
+ * @brief Get a thread local storage slot value of the current running thread.
+ *
+ * @param slot The slot index.
+ *
+ * @return The slot value.
+ */
+void *_impl_thread_tls_get(_u8_t slot)
+{
+    /* The interrupt handler has no own slots, the slots of the interrupted thread aren't touched */
+    if (!kernel_isInThreadMode()) {
+        return NULL;
+    }
+
+    void **ppTls = kernel_thread_tlsGet();
+    if ((!ppTls) || (slot >= THREAD_TLS_SLOT_NUMBER)) {
+        return NULL;
+    }
+
+    return ppTls[slot];
+}
+
+/**
+ * @brief Change a thread priority, the thread is repositioned in the pending or blocking list.
+ *
+ * @param id The thread unique id.
+ * @param priority The new thread priority.
+ *
+ * @return The result of thread priority set operation.
+ */
+_i32p_t _impl_thread_priority_set(_u32_t ctx, _i16_t priority)
+{
+    thread_context_t *pCtx = (thread_context_t *)ctx;
+    if (_thread_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_thread_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (priority > 0xFF) {
+        return PC_EOR;
+    }
+
+    if ((priority == OS_PRIOTITY_LOWEST_LEVEL) || (priority == OS_PRIOTITY_HIGHEST_LEVEL)) {
+        return PC_EOR;
+    }
+
+    /* The kernel and idle threads take the reserved levels only */
+    if ((pCtx->task.basePrior == OS_PRIORITY_KERNEL_SCHEDULE_LEVEL) || (pCtx->task.basePrior == OS_PRIORITY_KERNEL_IDLE_LEVEL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u16_val = (_u16_t)priority},
+    };
+
+    return kernel_privilege_invoke((const void *)_thread_priority_set_privilege_routine, arguments);
+}
+
+/**
+ * @brief Get a thread priority.
+ *
+ * @param id The thread unique id.
+ *
+ * @return The value of the thread priority.
+ */
+_i16_t _impl_thread_priority_get(_u32_t ctx)
+{
+    thread_context_t *pCtx = (thread_context_t *)ctx;
+    if (_thread_context_isInvalid(pCtx)) {
+        return OS_PRIOTITY_INVALID_LEVEL;
+    }
+
+    if (!_thread_context_isInit(pCtx)) {
+        return OS_PRIOTITY_INVALID_LEVEL;
+    }
+
+    return pCtx->task.prior;
+}
+
+/**
+ * @brief Get the number of the context switch which saved the thread FPU registers.
+ *
+ * @param id The thread unique id.
+ *
+ * @return The value of the FPU context switch number, the zero indicates the thread never used the FPU.
+ */
+_u32_t _impl_thread_fpu_switch_get(_u32_t ctx)
+{
+    thread_context_t *pCtx = (thread_context_t *)ctx;
+    if (_thread_context_isInvalid(pCtx)) {
+        return 0u;
+    }
+
+    if (!_thread_context_isInit(pCtx)) {
+        return 0u;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+    };
+
+    return kernel_privilege_invoke((const void *)_thread_fpu_switch_get_privilege_routine, arguments);
+}
+
 /**
  * @brief Resume a thread to run.
  *
@@ -576,7 +708,12 @@ _i32p_t _impl_thread_sleep(_u32_t timeout_ms)
         [0] = {.u32_val = (_u32_t)timeout_ms},
     };
 
-    return kernel_privilege_invoke((const void *)_thread_sleep_privilege_routine, arguments);
+    _i32p_t postcode = kernel_privilege_invoke((const void *)_thread_sleep_privilege_routine, arguments);
+    if ((kernel_stackless_runGet()) && (postcode == PC_OS_OK)) {
+        /* The stackless task returns to the runner thread, it's resumed when the sleep timeout */
+        postcode = PC_OS_WAIT_UNAVAILABLE;
+    }
+    return postcode;
 }
 
 void _impl_thread_entry(pThread_entryFunc_t pEntryFn, void *pArg)
@@ -14,6 +14,17 @@
  */
 #define PC_EOR PC_IER(PC_OS_CMPT_TIMER_8)
 
+/**
+ * Data structure for timer callback service
+ */
+typedef struct {
+    /* The pending timer callbacks in first-in first-out order */
+    list_fifo_t callback_fifo;
+
+    /* The service thread task blocked for the next callback */
+    struct schedule_task *pTask;
+} _timer_service_t;
+
 /**
  * Data structure for location timer
  */
@@ -30,7 +41,11 @@ typedef struct {
 
     list_t tt_idle_list;
 
-    list_t callback_list;
+    /* The lateness statistics of all timeout expiries */
+    struct timer_lateness lateness;
+
+    /* The service 0 is handled in the kernel thread, the others are handled in the timer service threads */
+    _timer_service_t service[TIMER_SERVICE_NUMBER_SUPPORTED];
 } _timer_resource_t;
 
 /**
@@ -66,6 +81,70 @@ static _b_t _timer_context_isInit(timer_context_t *pCurTimer)
     return (pCurTimer) ? (((pCurTimer->head.cs) ? (true) : (false))) : false;
 }
 
+/**
+ * @brief Convert the timeout value into microsecond.
+ *
+ * The timeout value is in millisecond, unless the OS_TIME_US_FLAG_VAL bit is set,
+ * then the rest bits are in microsecond and it's limited to the minimum clock interval.
+ *
+ * @param timeout The timeout value.
+ *
+ * @return The value of the timeout in microsecond.
+ */
+static _u64_t _timeout_value_toUs(_u32_t timeout)
+{
+    if (timeout & OS_TIME_US_FLAG_VAL) {
+        _u64_t us = (_u64_t)(timeout & OS_TIME_US_MASK_VAL);
+
+        return (us < PORTAL_SYSTEM_CLOCK_INTERVAL_MIN_US) ? (PORTAL_SYSTEM_CLOCK_INTERVAL_MIN_US) : (us);
+    }
+
+    return (_u64_t)timeout * 1000u;
+}
+
+/**
+ * @brief Record the lateness into the log2 buckets.
+ *
+ * @param pLateness The pointer of the lateness statistics.
+ * @param late_us The lateness time (us).
+ */
+static void _timeout_lateness_record(struct timer_lateness *pLateness, _u32_t late_us)
+{
+    _u8_t bucket = 0u;
+    _u32_t value = late_us;
+
+    if (value >= B(16u)) {
+        value >>= 16u;
+        bucket += 16u;
+    }
+    if (value >= B(8u)) {
+        value >>= 8u;
+        bucket += 8u;
+    }
+    if (value >= B(4u)) {
+        value >>= 4u;
+        bucket += 4u;
+    }
+    if (value >= B(2u)) {
+        value >>= 2u;
+        bucket += 2u;
+    }
+    if (value >= B(1u)) {
+        value >>= 1u;
+        bucket += 1u;
+    }
+    bucket += (_u8_t)value;
+
+    if (bucket >= TIMER_LATENESS_BUCKET_NUMBER) {
+        bucket = TIMER_LATENESS_BUCKET_NUMBER - 1u;
+    }
+    pLateness->bucket[bucket]++;
+
+    if (late_us > pLateness->max_us) {
+        pLateness->max_us = late_us;
+    }
+}
+
 /**
  * @brief Compare the customization value between the current and extract thread.
  *
@@ -180,13 +259,47 @@ static void _timeout_remove_fromWaitList(linker_t *pLinker)
     EXIT_CRITICAL_SECTION();
 }
 
+/**
+ * @brief Calculate the coalesced interval for the next clock interrupt.
+ *
+ * The waiting list is sorted by deadline, every node may be delayed by up to its slack time.
+ * The interval is pushed forward to the latest deadline which is still inside the slack window
+ * of all earlier nodes, so that the nearby expiries can be handled in one timeout handler pass.
+ *
+ * @param pHead The head node of the waiting list.
+ *
+ * @return The value of the coalesced interval.
+ */
+static _u64_t _timeout_coalesce_interval(struct expired_time *pHead)
+{
+    _u64_t deadline_us = pHead->duration_us;
+    _u64_t interval_us = deadline_us;
+    _u64_t window_us = deadline_us + pHead->slack_us;
+
+    struct expired_time *pNext = (struct expired_time *)pHead->linker.node.pNext;
+    while (pNext) {
+        deadline_us += pNext->duration_us;
+        if (deadline_us > window_us) {
+            break;
+        }
+        interval_us = deadline_us;
+
+        if ((deadline_us + pNext->slack_us) < window_us) {
+            window_us = deadline_us + pNext->slack_us;
+        }
+        pNext = (struct expired_time *)pNext->linker.node.pNext;
+    }
+
+    return interval_us;
+}
+
 static void _timeout_schedule(void)
 {
     ENTER_CRITICAL_SECTION();
 
     struct expired_time *pCurExpired = (struct expired_time *)g_timer_rsc.tt_wait_list.pHead;
     if (pCurExpired) {
-        clock_time_interval_set(pCurExpired->duration_us);
+        clock_time_interval_set(_timeout_coalesce_interval(pCurExpired));
     } else {
         clock_time_interval_set(OS_TIME_FOREVER_VAL);
     }
@@ -194,30 +307,116 @@ static void _timeout_schedule(void)
     EXIT_CRITICAL_SECTION();
 }
 
+/**
+ * @brief Calculate the next absolute deadline of the periodic timer.
+ *
+ * The deadline is anchored to the system time, so the period never drifts with the handler latency,
+ * and the missed periods are calculated once instead of stepping period by period.
+ *
+ * @param pCurTimer The pointer of the timer context.
+ *
+ * @return The number of the missed periods.
+ */
+static _u32_t _timer_cycle_deadline_update(timer_context_t *pCurTimer)
+{
+    _u64_t now_us = g_timer_rsc.system_us;
+    _u64_t period_us = pCurTimer->timeout_us;
+    _u32_t missed = 0u;
+
+    if (now_us >= pCurTimer->deadline_us) {
+        missed = (_u32_t)((now_us - pCurTimer->deadline_us) / period_us);
+        pCurTimer->deadline_us += ((_u64_t)missed + 1u) * period_us;
+    }
+    pCurTimer->overrun += missed;
+    pCurTimer->expire.duration_us = pCurTimer->deadline_us - now_us;
+
+    return missed;
+}
+
+/**
+ * @brief Invoke the timer callback.
+ *
+ * @param pCall The pointer of the timer callback.
+ * @param pending The number of the callback invoking.
+ * @param missed The number of the missed periods.
+ */
+static void _timer_callback_invoke(struct timer_callback *pCall, _u32_t pending, _u32_t missed)
+{
+    if (pCall->pTimerMissedEntry) {
+        pCall->pTimerMissedEntry((void *)pCall->pUserData, missed);
+    } else if (pCall->pTimerCallEntry) {
+        while (pending--) {
+            pCall->pTimerCallEntry((void *)pCall->pUserData);
+        }
+    }
+}
+
+/**
+ * @brief Release the timer context slot, it's called when nothing refers to the timer anymore.
+ *
+ * @param pCurTimer The pointer of the timer context.
+ */
+static void _timer_context_release(timer_context_t *pCurTimer)
+{
+    init_name_unregister(INIT_SLOT_TIMER, pCurTimer);
+    k_memset((_u8_t *)pCurTimer, 0u, sizeof(timer_context_t));
+    init_slot_free(INIT_SLOT_TIMER, pCurTimer);
+}
+
+/**
+ * @brief Check if the temporary timer is expired and not restarted, its slot is released after the callback.
+ *
+ * @param pCurTimer The pointer of the timer context.
+ *
+ * @return The true indicates the timer slot has to be released.
+ */
+static _b_t _timer_temporary_isExpired(timer_context_t *pCurTimer)
+{
+    return ((pCurTimer->control == TIMER_CTRL_TEMPORARY_VAL) && (!pCurTimer->expire.linker.pList)) ? (true) : (false);
+}
+
 void timer_callback_fromTimeOut(void *pNode)
 {
     timer_context_t *pCurTimer = (timer_context_t *)CONTAINEROF(pNode, timer_context_t, expire);
     struct expired_time *pExpired = (struct expired_time *)&pCurTimer->expire;
+    _u32_t missed = 0u;
 
     if (pCurTimer->control == TIMER_CTRL_CYCLE_VAL) {
-        _u64_t timeout_us = pCurTimer->timeout_ms * 1000u;
-        _u64_t elapsed_us = g_timer_rsc.system_us - pExpired->duration_us;
-
-        while (elapsed_us >= timeout_us) {
-            elapsed_us -= timeout_us;
-        }
-        pExpired->duration_us = timeout_us - elapsed_us;
+        missed = _timer_cycle_deadline_update(pCurTimer);
         _timeout_transfer_toWaitList((linker_t *)&pExpired->linker);
     } else if (pCurTimer->control == TIMER_CTRL_ONCE_VAL) {
         _timeout_transfer_toIdleList((linker_t *)&pExpired->linker);
     } else if (pCurTimer->control == TIMER_CTRL_TEMPORARY_VAL) {
+        /* The temporary timer slot is released after its callback was consumed */
         _timeout_transfer_toNoInitList((linker_t *)&pExpired->linker);
-        k_memset((_u8_t *)pCurTimer, 0u, sizeof(timer_context_t));
     }
 
-    list_t *pCallback_list = (list_t *)&g_timer_rsc.callback_list;
-    if (!list_node_isExisted(pCallback_list, &pCurTimer->call.node)) {
-        list_node_push((list_t *)&g_timer_rsc.callback_list, &pCurTimer->call.node, LIST_HEAD);
+    struct timer_callback *pCall = &pCurTimer->call;
+    if (pCurTimer->service == TIMER_SERVICE_HARD_VAL) {
+        /* The hard timer callback runs in the clock interrupt directly */
+        _timer_callback_invoke(pCall, (pCurTimer->catchup == TIMER_CATCHUP_BURST_VAL) ? (missed + 1u) : (1u), missed);
+        if (_timer_temporary_isExpired(pCurTimer)) {
+            _timer_context_release(pCurTimer);
+        }
+        return;
+    }
+
+    _b_t queued = (pCall->pending) ? (true) : (false);
+    if (pCurTimer->catchup == TIMER_CATCHUP_BURST_VAL) {
+        pCall->pending += (missed + 1u);
+    } else {
+        pCall->pending = 1u;
+    }
+    pCall->missed += missed;
+
+    if (!queued) {
+        _timer_service_t *pService = &g_timer_rsc.service[pCurTimer->service];
+        list_fifo_push(&pService->callback_fifo, &pCall->node);
+
+        if (pService->pTask) {
+            schedule_entry_trigger(pService->pTask, NULL, PC_OS_WAIT_AVAILABLE);
+            pService->pTask = NULL;
+        }
     }
 }
 
@@ -263,29 +462,23 @@ static _u32_t _timer_init_privilege_routine(arguments_t *pArgs)
     void *pUserData = (void *)pArgs[1].pv_val;
     const _char_t *pName = (const _char_t *)pArgs[2].pch_val;
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_TIMER_LIST, timer_context_t, pCurTimer)
-    {
-        if (_timer_context_isInvalid(pCurTimer)) {
-            break;
-        }
-
-        if (_timer_context_isInit(pCurTimer)) {
-            continue;
-        }
-
-        k_memset((_char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
-        pCurTimer->head.cs = CS_INITED;
-        pCurTimer->head.pName = pName;
-        pCurTimer->call.pUserData = pUserData;
-        pCurTimer->call.pTimerCallEntry = pCallFun;
-        timeout_init(&pCurTimer->expire, timer_callback_fromTimeOut);
-
+    timer_context_t *pCurTimer = (timer_context_t *)init_slot_alloc(INIT_SLOT_TIMER);
+    if (!pCurTimer) {
         EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurTimer;
+        return 0u;
     }
 
+    k_memset((_char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
+    pCurTimer->head.cs = CS_INITED;
+    pCurTimer->head.pName = pName;
+    pCurTimer->call.pUserData = pUserData;
+    pCurTimer->call.pTimerCallEntry = pCallFun;
+    timeout_init(&pCurTimer->expire, timer_callback_fromTimeOut);
+
+    init_name_register(INIT_SLOT_TIMER, pCurTimer);
+
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurTimer;
 }
 
 /**
@@ -303,30 +496,22 @@ static _u32_t _timer_automatic_privilege_routine(arguments_t *pArgs)
     void *pUserData = (void *)pArgs[1].pv_val;
     const _char_t *pName = (const _char_t *)pArgs[2].pch_val;
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_TIMER_LIST, timer_context_t, pCurTimer)
-    {
-        if (_timer_context_isInvalid(pCurTimer)) {
-            break;
-        }
-
-        if (_timer_context_isInit(pCurTimer)) {
-            continue;
-        }
-
-        k_memset((_char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
-        pCurTimer->head.cs = CS_INITED;
-        pCurTimer->head.pName = pName;
-        pCurTimer->control = TIMER_CTRL_TEMPORARY_VAL;
-        pCurTimer->call.pUserData = pUserData;
-        pCurTimer->call.pTimerCallEntry = pCallFun;
-        timeout_init(&pCurTimer->expire, timer_callback_fromTimeOut);
-
+    timer_context_t *pCurTimer = (timer_context_t *)init_slot_alloc(INIT_SLOT_TIMER);
+    if (!pCurTimer) {
         EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurTimer;
+        return 0u;
     }
 
+    k_memset((_char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
+    pCurTimer->head.cs = CS_INITED;
+    pCurTimer->head.pName = pName;
+    pCurTimer->control = TIMER_CTRL_TEMPORARY_VAL;
+    pCurTimer->call.pUserData = pUserData;
+    pCurTimer->call.pTimerCallEntry = pCallFun;
+    timeout_init(&pCurTimer->expire, timer_callback_fromTimeOut);
+
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurTimer;
 }
 
 /**
@@ -344,7 +529,11 @@ static _u32_t _timer_start_privilege_routine(arguments_t *pArgs)
     _u8_t ctrl = (_u8_t)pArgs[1].u8_val;
     _u32_t timeout_ms = (_u32_t)pArgs[2].u32_val;
 
-    pCurTimer->timeout_ms = timeout_ms;
+    pCurTimer->timeout_us = _timeout_value_toUs(timeout_ms);
+    pCurTimer->deadline_us = g_timer_rsc.system_us + pCurTimer->timeout_us;
+    pCurTimer->overrun = 0u;
+    k_memset((_u8_t *)&pCurTimer->lateness, 0u, sizeof(struct timer_lateness));
+    pCurTimer->call.missed = 0u;
     pCurTimer->control = ctrl;
     timeout_set(&pCurTimer->expire, timeout_ms, true);
 
@@ -352,6 +541,138 @@ static _u32_t _timer_start_privilege_routine(arguments_t *pArgs)
     return 0;
 }
 
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _timer_service_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
+    _u8_t service = (_u8_t)pArgs[1].u8_val;
+
+    pCurTimer->service = service;
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _timer_service_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    _timer_service_t *pService = (_timer_service_t *)pArgs[0].pv_val;
+    _i32p_t postcode = 0;
+
+    if (!pService->callback_fifo.pHead) {
+        thread_context_t *pCurThread = kernel_thread_runContextGet();
+        pService->pTask = &pCurThread->task;
+        postcode = schedule_exit_trigger(&pCurThread->task, pService, NULL, schedule_waitList(), OS_TIME_FOREVER_VAL, true);
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _timer_catchup_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
+    _u8_t catchup = (_u8_t)pArgs[1].u8_val;
+    pTimer_missedCallbackFunc_t pMissedFun = (pTimer_missedCallbackFunc_t)(pArgs[2].ptr_val);
+
+    pCurTimer->catchup = catchup;
+    pCurTimer->call.pTimerMissedEntry = (catchup == TIMER_CATCHUP_COALESCE_VAL) ? (pMissedFun) : (NULL);
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _u32_t _timer_overrun_get_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
+    _u32_t overrun = pCurTimer->overrun;
+
+    EXIT_CRITICAL_SECTION();
+    return overrun;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _timer_lateness_get_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
+    struct timer_lateness *pLateness = (struct timer_lateness *)pArgs[1].pv_val;
+
+    if (pCurTimer) {
+        *pLateness = pCurTimer->lateness;
+    } else {
+        *pLateness = g_timer_rsc.lateness;
+        pLateness->clamped = clock_time_clamped_get();
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _timer_slack_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
+    _u32_t slack_us = (_u32_t)pArgs[1].u32_val;
+
+    pCurTimer->expire.slack_us = slack_us;
+    if (pCurTimer->expire.linker.pList == &g_timer_rsc.tt_wait_list) {
+        _timeout_schedule();
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -384,7 +705,13 @@ static _i32p_t _timer_delete_privilege_routine(arguments_t *pArgs)
     timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
     timeout_remove(&pCurTimer->expire, true);
     _timeout_transfer_toNoInitList((linker_t *)&pCurTimer->expire.linker);
-    k_memset((_char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
+
+    struct timer_callback *pCall = &pCurTimer->call;
+    if ((pCall->pending) && (pCurTimer->service != TIMER_SERVICE_HARD_VAL)) {
+        /* The queued callback is dropped, the service must not touch the released slot */
+        list_fifo_remove(&g_timer_rsc.service[pCurTimer->service].callback_fifo, &pCall->node);
+    }
+    _timer_context_release(pCurTimer);
 
     EXIT_CRITICAL_SECTION();
     return 0;
@@ -413,9 +740,14 @@ static _u32_t _timer_total_system_ms_get_privilege_routine(arguments_t *pArgs)
     return ms;
 }
 
-static _u32_t _system_us_get(void)
+/**
+ * @brief Get the 64-bit monotonic system time includes the unreported clock elapsed time.
+ *
+ * @return The value of the system time (us).
+ */
+static _u64_t _system_us_get(void)
 {
-    _u32_t us = (_u32_t)((!g_timer_rsc.remaining_us) ? (clock_time_elapsed_get()) : (0u));
+    _u64_t us = (!g_timer_rsc.remaining_us) ? (clock_time_elapsed_get()) : (0u);
 
     us += g_timer_rsc.system_us;
 
@@ -435,12 +767,32 @@ static _u32_t _timer_total_system_us_get_privilege_routine(arguments_t *pArgs)
 
     UNUSED_MSG(pArgs);
 
-    _u32_t us = _system_us_get();
+    _u32_t us = (_u32_t)_system_us_get();
 
     EXIT_CRITICAL_SECTION();
     return us;
 }
 
+#if (!THREAD_PSP_WITH_PRIVILEGED)
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _timer_total_system_us64_get_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    _u64_t *pUs = (_u64_t *)pArgs[0].pv_val;
+    *pUs = _system_us_get();
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+#endif
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -458,9 +810,9 @@ static _u32_t _system_busy_wait_privilege_routine(arguments_t *pArgs)
     if (disabled) {
         clock_time_enable();
     }
-    _u32_t start = _system_us_get();
+    _u64_t start = _system_us_get();
     while (wait_us) {
-        _u32_t current = _system_us_get();
+        _u64_t current = _system_us_get();
 
         if ((current - start) >= wait_us) {
             break;
@@ -474,6 +826,31 @@ static _u32_t _system_busy_wait_privilege_routine(arguments_t *pArgs)
     return 0;
 }
 
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _timer_core_clock_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    _u32_t mhz = (_u32_t)pArgs[0].u32_val;
+    pClock_switchFunc_t pSwitchFun = (pClock_switchFunc_t)pArgs[1].ptr_val;
+
+    /**
+     * The tt_wait_list deadlines are relative to the reported system time,
+     * the clock carries the unreported elapsed time to the new frequency, then the next interval is reprogrammed.
+     */
+    clock_time_rate_set(mhz, pSwitchFun);
+    _timeout_schedule();
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
 /**
  * @brief Initialize a new timer, or allocate a temporary timer to run.
  *
@@ -494,6 +871,20 @@ _u32_t _impl_timer_init(pTimer_callbackFunc_t pCallFun, void *pUserData, const _
     return kernel_privilege_invoke((const void *)_timer_init_privilege_routine, arguments);
 }
 
+/**
+ * @brief Find a timer id by its name.
+ *
+ * @param pName The timer name.
+ *
+ * @return The value of timer unique id.
+ */
+_u32_t _impl_timer_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_TIMER, pName);
+}
+
 /**
  * @brief Allocate a temporary timer to run.
  *
@@ -520,7 +911,7 @@ _u32_t _impl_timer_automatic(pTimer_callbackFunc_t pCallFun, void *pUserData, co
  *
  * @param ctx The timer unique id.
  * @param control It defines the timer running mode.
- * @param timeout_ms The timer expired time.
+ * @param timeout_ms The timer expired time, the OS_TIME_US_FLAG_VAL bit indicates it's in microsecond.
  *
  * @return The result of timer start operation.
  */
@@ -552,6 +943,177 @@ _i32p_t _impl_timer_start(_u32_t ctx, _u8_t control, _u32_t timeout_ms)
     return kernel_privilege_invoke((const void *)_timer_start_privilege_routine, arguments);
 }
 
+/**
+ * @brief Assign the timer callback to a service thread.
+ *
+ * @param ctx The timer unique id.
+ * @param service The service number, the 0 indicates the kernel thread,
+ *                the TIMER_SERVICE_HARD_VAL indicates the callback runs in the clock interrupt.
+ *
+ * @return The result of timer service set operation.
+ */
+_i32p_t _impl_timer_service_set(_u32_t ctx, _u8_t service)
+{
+    timer_context_t *pCtx = (timer_context_t *)ctx;
+    if (_timer_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_timer_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((service >= TIMER_SERVICE_NUMBER_SUPPORTED) && (service != TIMER_SERVICE_HARD_VAL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u8_val = (_u8_t)service},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_service_set_privilege_routine, arguments);
+}
+
+/**
+ * @brief Set the periodic timer catch-up policy when the periods are missed.
+ *
+ * @param ctx The timer unique id.
+ * @param catchup The catch-up policy, skip the missed periods, burst a callback for each missed period,
+ *                or coalesce them into one callback with the missed count.
+ * @param pMissedFun The coalesced callback with the missed count, the NULL indicates the normal callback.
+ *
+ * @return The result of timer catch-up set operation.
+ */
+_i32p_t _impl_timer_catchup_set(_u32_t ctx, _u8_t catchup, pTimer_missedCallbackFunc_t pMissedFun)
+{
+    timer_context_t *pCtx = (timer_context_t *)ctx;
+    if (_timer_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_timer_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((catchup != TIMER_CATCHUP_SKIP_VAL) && (catchup != TIMER_CATCHUP_BURST_VAL) && (catchup != TIMER_CATCHUP_COALESCE_VAL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u8_val = (_u8_t)catchup},
+        [2] = {.ptr_val = (const void *)pMissedFun},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_catchup_set_privilege_routine, arguments);
+}
+
+/**
+ * @brief Get the total number of the missed periods since the timer started.
+ *
+ * @param ctx The timer unique id.
+ *
+ * @return The value of the timer overrun counter.
+ */
+_u32_t _impl_timer_overrun_get(_u32_t ctx)
+{
+    timer_context_t *pCtx = (timer_context_t *)ctx;
+    if (_timer_context_isInvalid(pCtx)) {
+        return 0u;
+    }
+
+    if (!_timer_context_isInit(pCtx)) {
+        return 0u;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_overrun_get_privilege_routine, arguments);
+}
+
+/**
+ * @brief Get the timer lateness statistics.
+ *
+ * @param ctx The timer unique id.
+ * @param pLateness The pointer of the lateness statistics.
+ *
+ * @return The result of timer lateness get operation.
+ */
+_i32p_t _impl_timer_lateness_get(_u32_t ctx, struct timer_lateness *pLateness)
+{
+    timer_context_t *pCtx = (timer_context_t *)ctx;
+    if (_timer_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_timer_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!pLateness) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.pv_val = (void *)pLateness},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_lateness_get_privilege_routine, arguments);
+}
+
+/**
+ * @brief Get the lateness statistics of all timeout expiries, includes the thread timeout and the clamped interval number.
+ *
+ * @param pLateness The pointer of the lateness statistics.
+ *
+ * @return The result of system lateness get operation.
+ */
+_i32p_t _impl_timer_system_lateness_get(struct timer_lateness *pLateness)
+{
+    if (!pLateness) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = 0u},
+        [1] = {.pv_val = (void *)pLateness},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_lateness_get_privilege_routine, arguments);
+}
+
+/**
+ * @brief Set the timer slack time, the timer expiry is allowed to be delayed within it
+ *        in order to be coalesced with the other nearby expiries into one clock interrupt.
+ *
+ * @param ctx The timer unique id.
+ * @param slack_us The tolerance window time (us), the zero value indicates an exact expiry.
+ *
+ * @return The result of timer slack set operation.
+ */
+_i32p_t _impl_timer_slack_set(_u32_t ctx, _u32_t slack_us)
+{
+    timer_context_t *pCtx = (timer_context_t *)ctx;
+    if (_timer_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_timer_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u32_val = (_u32_t)slack_us},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_slack_set_privilege_routine, arguments);
+}
+
 /**
  * @brief timer stops operation.
  *
@@ -648,6 +1210,35 @@ _u32_t _impl_timer_total_system_us_get(void)
     return kernel_privilege_invoke((const void *)_timer_total_system_us_get_privilege_routine, NULL);
 }
 
+/**
+ * @brief Get the kernel RTOS 64-bit monotonic system time (us), it never wraps in practice.
+ *
+ * @return The value of the total system time (us).
+ */
+_u64_t _impl_timer_total_system_us64_get(void)
+{
+    _u64_t us = 0u;
+
+#if (!THREAD_PSP_WITH_PRIVILEGED)
+    if (kernel_isInThreadMode()) {
+        /* The unprivileged thread can't access the clock registers */
+        arguments_t arguments[] = {
+            [0] = {.pv_val = (void *)&us},
+        };
+
+        kernel_privilege_invoke((const void *)_timer_total_system_us64_get_privilege_routine, arguments);
+        return us;
+    }
+#endif
+
+    /* It's a short read, the critical section is cheaper than the privilege call trap */
+    ENTER_CRITICAL_SECTION();
+    us = _system_us_get();
+    EXIT_CRITICAL_SECTION();
+
+    return us;
+}
+
 _u32_t _impl_system_busy_wait(_u32_t us)
 {
     arguments_t arguments[] = {
@@ -657,6 +1248,38 @@ _u32_t _impl_system_busy_wait(_u32_t us)
     return kernel_privilege_invoke((const void *)_system_busy_wait_privilege_routine, arguments);
 }
 
+/**
+ * @brief Change the core clock frequency at runtime, the pending timeout deadlines keep correct.
+ *
+ * @param mhz The new core clock frequency (MHz).
+ * @param pSwitchFun The function to switch the core clock hardware, it supported NULL pointer.
+ *
+ * @return The result of core clock set operation.
+ */
+_i32p_t _impl_timer_core_clock_set(_u32_t mhz, pClock_switchFunc_t pSwitchFun)
+{
+    if (!clock_time_rate_isValid(mhz)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)mhz},
+        [1] = {.ptr_val = (const void *)pSwitchFun},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_core_clock_set_privilege_routine, arguments);
+}
+
+/**
+ * @brief Get the current core clock frequency.
+ *
+ * @return The value of the core clock frequency (MHz).
+ */
+_u32_t _impl_timer_core_clock_get(void)
+{
+    return clock_time_rate_get();
+}
+
 /**
  * @brief Get the kernel RTOS system time (ms).
  *
@@ -677,6 +1300,49 @@ _u32_t timer_total_system_us_get(void)
     return _impl_timer_total_system_us_get();
 }
 
+/**
+ * @brief Get the kernel RTOS 64-bit monotonic system time (us).
+ *
+ * @return The value of the total system time (us).
+ */
+_u64_t timer_total_system_us64_get(void)
+{
+    return _impl_timer_total_system_us64_get();
+}
+
+/**
+ * @brief Get the remaining time to the next timeout deadline, it must be called in the critical section.
+ *
+ * @return The value of the remaining time (us), the OS_TIME_FOREVER_VAL indicates no deadline.
+ */
+_u32_t timer_next_expiry_us_get(void)
+{
+    struct expired_time *pCurExpired = (struct expired_time *)g_timer_rsc.tt_wait_list.pHead;
+    if (!pCurExpired) {
+        return OS_TIME_FOREVER_VAL;
+    }
+
+    _u64_t elapsed_us = clock_time_elapsed_get();
+    if (pCurExpired->duration_us <= elapsed_us) {
+        return 0u;
+    }
+
+    _u64_t remaining_us = pCurExpired->duration_us - elapsed_us;
+    return (remaining_us >= OS_TIME_FOREVER_VAL) ? (OS_TIME_FOREVER_VAL - 1u) : ((_u32_t)remaining_us);
+}
+
+/**
+ * @brief Compensate the system time with the sleep time which is not counted by the clock.
+ *
+ * @param sleep_us The sleep time (us).
+ */
+void timer_sleep_compensate(_u32_t sleep_us)
+{
+    if (sleep_us) {
+        timeout_handler(sleep_us);
+    }
+}
+
 /**
  * @brief kernel RTOS request to update new schedule.
  *
@@ -687,31 +1353,86 @@ _i32p_t timer_schedule(void)
     return _timer_schedule();
 }
 
+/**
+ * @brief Pop a timer callback and copy it with its pending and missed count.
+ *
+ * @param pFifo The pointer of the callback fifo.
+ * @param pCall The pointer of the callback copy.
+ *
+ * @return The true indicates a timer callback was popped.
+ */
+static _b_t _timer_callback_pop(list_fifo_t *pFifo, struct timer_callback *pCall)
+{
+    ENTER_CRITICAL_SECTION();
+
+    struct timer_callback *pCallFunEntry = (struct timer_callback *)list_fifo_pop(pFifo);
+    if (pCallFunEntry) {
+        *pCall = *pCallFunEntry;
+        pCallFunEntry->pending = 0u;
+        pCallFunEntry->missed = 0u;
+
+        /* The callback was copied out, so the expired temporary timer slot is released before it's invoked */
+        timer_context_t *pCurTimer = (timer_context_t *)CONTAINEROF(pCallFunEntry, timer_context_t, call);
+        if (_timer_temporary_isExpired(pCurTimer)) {
+            _timer_context_release(pCurTimer);
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return (pCallFunEntry) ? (true) : (false);
+}
+
+/**
+ * @brief Run all pending timer callbacks of the service.
+ *
+ * @param pService The pointer of the timer service.
+ */
+static void _timer_service_callback_run(_timer_service_t *pService)
+{
+    list_fifo_t *pFifo = &pService->callback_fifo;
+    struct timer_callback call = {0};
+
+    while (_timer_callback_pop(pFifo, &call)) {
+        _timer_callback_invoke(&call, call.pending, call.missed);
+    }
+}
+
 /**
  * @brief Timer callback function handle in the kernel thread.
  */
 void timer_reamining_elapsed_handler(void)
 {
-    list_t *pListRunning = (list_t *)&g_timer_rsc.callback_list;
+    _timer_service_callback_run(&g_timer_rsc.service[0]);
+}
 
-    ENTER_CRITICAL_SECTION();
-    struct timer_callback *pCallFunEntry = (struct timer_callback *)list_node_pop(pListRunning, LIST_TAIL);
-    EXIT_CRITICAL_SECTION();
+/**
+ * @brief The timer service thread entry function, it handles the timer callbacks of the service.
+ *
+ * @param pArg The service number.
+ */
+void _impl_timer_service_thread(void *pArg)
+{
+    _u32_t service = (_u32_t)pArg;
+    if ((!service) || (service >= TIMER_SERVICE_NUMBER_SUPPORTED)) {
+        return;
+    }
 
-    while (pCallFunEntry) {
-        if (pCallFunEntry->pTimerCallEntry) {
-            pCallFunEntry->pTimerCallEntry((void *)pCallFunEntry->pUserData);
-        }
+    _timer_service_t *pService = &g_timer_rsc.service[service];
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)pService},
+    };
 
-        ENTER_CRITICAL_SECTION();
-        pCallFunEntry = (struct timer_callback *)list_node_pop(pListRunning, LIST_TAIL);
-        EXIT_CRITICAL_SECTION();
+    while (1) {
+        kernel_privilege_invoke((const void *)_timer_service_wait_privilege_routine, arguments);
+
+        _timer_service_callback_run(pService);
     }
 }
 
 void timeout_init(struct expired_time *pExpire, pTimeout_callbackFunc_t fun)
 {
     pExpire->duration_us = 0u;
+    pExpire->slack_us = 0u;
     pExpire->fn = fun;
     _timeout_transfer_toIdleList((linker_t *)pExpire);
 }
@@ -730,7 +1451,7 @@ void timeout_set(struct expired_time *pExpire, _u32_t timeout_ms, _b_t immediate
             _timeout_transfer_toIdleList((linker_t *)&pExpire->linker);
         }
     } else {
-        pExpire->duration_us = timeout_ms * 1000u;
+        pExpire->duration_us = _timeout_value_toUs(timeout_ms);
         _timeout_transfer_toWaitList((linker_t *)&pExpire->linker);
         need = true;
     }
@@ -780,11 +1501,17 @@ void timeout_handler(_u32_t elapsed_us)
             g_timer_rsc.system_us += pCurExpired->duration_us;
             pCurExpired->duration_us = 0u;
 
+            /* The rest of the reported elapsed time is how late the deadline is handled */
+            _timeout_lateness_record(&g_timer_rsc.lateness, g_timer_rsc.remaining_us);
+
             if (pCurExpired->fn != timer_callback_fromTimeOut) {
                 pCurExpired->fn((void *)&pCurExpired->linker.node);
 
                 _timeout_transfer_toIdleList((linker_t *)&pCurExpired->linker);
             } else {
+                timer_context_t *pCurTimer = (timer_context_t *)CONTAINEROF(pCurExpired, timer_context_t, expire);
+                _timeout_lateness_record(&pCurTimer->lateness, g_timer_rsc.remaining_us);
+
                 pCurExpired->duration_us = g_timer_rsc.system_us;
                 _timeout_transfer_toPendList((linker_t *)&pCurExpired->linker);
             }
@@ -796,17 +1523,16 @@ void timeout_handler(_u32_t elapsed_us)
     g_timer_rsc.system_us += g_timer_rsc.remaining_us;
     g_timer_rsc.remaining_us = 0u;
 
-    _b_t need = false;
     list_t *pListPending = (list_t *)&g_timer_rsc.tt_pend_list;
     list_iterator_init(&it, pListPending);
     while (list_iterator_next_condition(&it, (void *)&pCurExpired)) {
         if (pCurExpired->fn != NULL) {
             pCurExpired->fn((void *)&pCurExpired->linker.node);
-            need = true;
         }
     }
 
-    if (need) {
+    /* The hard timers and the other services callbacks don't need the kernel thread */
+    if (g_timer_rsc.service[0].callback_fifo.pHead) {
         kernel_message_notification();
     }
     _timer_schedule();
@@ -6,6 +6,189 @@
  **/
 #include "static_init.h"
 
+/**
+ * Local free slot list head of the runtime kernel objects.
+ * A free slot keeps the head.cs zero and the head.pName NULL, the head.pHashNext is reused to link the next free slot,
+ * a free slot isn't in any name hash bucket.
+ */
+typedef struct {
+    struct base_head *pFree;
+
+    _b_t built;
+} init_slot_t;
+
+/**
+ * Local free slot lists, it's indexed by the kernel object type.
+ */
+static init_slot_t g_init_slot[INIT_SLOT_NUM] = {0};
+
+/**
+ * Local name hash index of the kernel objects.
+ */
+typedef struct {
+    struct base_head *pBucket[NAME_HASH_BUCKET_NUMBER];
+
+    _b_t built;
+} init_name_t;
+
+/**
+ * Local name hash index, all kernel object types share the buckets.
+ */
+static init_name_t g_init_name = {0};
+
+/**
+ * @brief Get the section address range and element size of the kernel object type.
+ *
+ * @param type The kernel object type.
+ * @param pBegin The first address of the section.
+ * @param pEnd The last address of the section.
+ *
+ * @return The element size of the section, zero is an unknown type.
+ */
+static _u32_t _init_slot_section_get(_u8_t type, _u32_t *pBegin, _u32_t *pEnd)
+{
+    _u32_t begin = 0u, end = 0u, size = 0u;
+
+    switch (type) {
+    case INIT_SLOT_THREAD:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_THREAD_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_THREAD_LIST, end);
+        size = sizeof(thread_context_t);
+        break;
+    case INIT_SLOT_TIMER:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_TIMER_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_TIMER_LIST, end);
+        size = sizeof(timer_context_t);
+        break;
+    case INIT_SLOT_SEMAPHORE:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_SEMAPHORE_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_SEMAPHORE_LIST, end);
+        size = sizeof(semaphore_context_t);
+        break;
+    case INIT_SLOT_MUTEX:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_MUTEX_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_MUTEX_LIST, end);
+        size = sizeof(mutex_context_t);
+        break;
+    case INIT_SLOT_RWLOCK:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_RWLOCK_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_RWLOCK_LIST, end);
+        size = sizeof(rwlock_context_t);
+        break;
+    case INIT_SLOT_EVENT:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_EVENT_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_EVENT_LIST, end);
+        size = sizeof(event_context_t);
+        break;
+    case INIT_SLOT_QUEUE:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_QUEUE_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_QUEUE_LIST, end);
+        size = sizeof(queue_context_t);
+        break;
+    case INIT_SLOT_POOL:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_POOL_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_POOL_LIST, end);
+        size = sizeof(pool_context_t);
+        break;
+    case INIT_SLOT_PUBLISH:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_PUBLISH_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_PUBLISH_LIST, end);
+        size = sizeof(publish_context_t);
+        break;
+    case INIT_SLOT_SUBSCRIBE:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_SUBSCRIBE_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_SUBSCRIBE_LIST, end);
+        size = sizeof(subscribe_context_t);
+        break;
+    default:
+        break;
+    }
+
+    *pBegin = begin;
+    *pEnd = end;
+    return size;
+}
+
+/**
+ * @brief Build the free slot list from the section table once.
+ *
+ * The section is walked backward so the allocation order keeps the section order.
+ * The statically defined objects have been initialized already, they're not collected.
+ *
+ * @param type The kernel object type.
+ */
+static void _init_slot_build(_u8_t type)
+{
+    init_slot_t *pSlot = &g_init_slot[type];
+    _u32_t begin, end;
+    _u32_t size = _init_slot_section_get(type, &begin, &end);
+
+    pSlot->pFree = NULL;
+    pSlot->built = true;
+    if (!size) {
+        return;
+    }
+
+    for (_u32_t addr = begin + ((end - begin) / size) * size; addr > begin;) {
+        addr -= size;
+        struct base_head *pHead = (struct base_head *)addr;
+        if (pHead->cs) {
+            continue;
+        }
+        pHead->pHashNext = pSlot->pFree;
+        pSlot->pFree = pHead;
+    }
+}
+
+/**
+ * @brief Take a free slot of the kernel object type in constant time.
+ *
+ * @param type The kernel object type.
+ *
+ * @return The free slot address, NULL is no free slot.
+ */
+void *init_slot_alloc(_u8_t type)
+{
+    if (type >= INIT_SLOT_NUM) {
+        return NULL;
+    }
+
+    init_slot_t *pSlot = &g_init_slot[type];
+    if (!pSlot->built) {
+        _init_slot_build(type);
+    }
+
+    struct base_head *pHead = pSlot->pFree;
+    if (pHead) {
+        pSlot->pFree = pHead->pHashNext;
+        pHead->pHashNext = NULL;
+    }
+    return (void *)pHead;
+}
+
+/**
+ * @brief Give a released slot back to the free list in constant time.
+ *
+ * @param type The kernel object type.
+ * @param pSlot The released slot, its head.cs must be cleared already.
+ */
+void init_slot_free(_u8_t type, void *pSlot)
+{
+    if ((type >= INIT_SLOT_NUM) || (!pSlot)) {
+        return;
+    }
+
+    init_slot_t *pFreeSlot = &g_init_slot[type];
+    if (!pFreeSlot->built) {
+        /* The first build collects it from the section table. */
+        return;
+    }
+
+    struct base_head *pHead = (struct base_head *)pSlot;
+    pHead->pHashNext = pFreeSlot->pFree;
+    pFreeSlot->pFree = pHead;
+}
+
 void init_func_level(_u8_t level)
 {
     INIT_SECTION_FOREACH(INIT_SECTION_FUNC, init_func_t, ifun)
@@ -34,3 +217,171 @@ void init_static_thread_list(void)
         }
     }
 }
+
+/**
+ * @brief Calculate the bucket index of the object name.
+ *
+ * @param type The kernel object type.
+ * @param pName The object name string.
+ *
+ * @return The bucket index.
+ */
+static _u32_t _init_name_hash(_u8_t type, const _char_t *pName)
+{
+    /* FNV-1a, the type is mixed in first so the same name of the different types spreads out */
+    _u32_t hash = (2166136261u ^ type) * 16777619u;
+
+    while (*pName) {
+        hash = (hash ^ (_u8_t)(*pName++)) * 16777619u;
+    }
+    return hash % NAME_HASH_BUCKET_NUMBER;
+}
+
+/**
+ * @brief To check if the object is located at the section of the kernel object type.
+ *
+ * @param type The kernel object type.
+ * @param pHead The object head.
+ *
+ * @return The true is the same type, otherwise is not.
+ */
+static _b_t _init_name_type_isMatch(_u8_t type, struct base_head *pHead)
+{
+    _u32_t begin, end;
+
+    if (!_init_slot_section_get(type, &begin, &end)) {
+        return false;
+    }
+    return (((_u32_t)pHead >= begin) && ((_u32_t)pHead < end)) ? true : false;
+}
+
+/**
+ * @brief To check if the both name strings are the same.
+ *
+ * @param pName The first name string.
+ * @param pOther The second name string.
+ *
+ * @return The true is the same name, otherwise is not.
+ */
+static _b_t _init_name_isSame(const _char_t *pName, const _char_t *pOther)
+{
+    if (pName == pOther) {
+        /* The interned string literal is compared by address directly */
+        return true;
+    }
+    return (k_memcmp(pName, pOther, k_strlen((const _uchar_t *)pName) + 1u)) ? false : true;
+}
+
+/**
+ * @brief Insert the named object into the hash bucket.
+ *
+ * @param type The kernel object type.
+ * @param pHead The object head.
+ */
+static void _init_name_insert(_u8_t type, struct base_head *pHead)
+{
+    struct base_head **ppBucket = &g_init_name.pBucket[_init_name_hash(type, pHead->pName)];
+
+    pHead->pHashNext = *ppBucket;
+    *ppBucket = pHead;
+}
+
+/**
+ * @brief Build the name hash index from the section tables once.
+ *
+ * It's called at the first lookup, the statically defined objects and the objects created before are indexed together.
+ */
+static void _init_name_build(void)
+{
+    g_init_name.built = true;
+
+    for (_u8_t type = 0u; type < INIT_SLOT_NUM; type++) {
+        _u32_t begin, end;
+        _u32_t size = _init_slot_section_get(type, &begin, &end);
+        if (!size) {
+            continue;
+        }
+
+        for (_u32_t addr = begin; (addr + size) <= end; addr += size) {
+            struct base_head *pHead = (struct base_head *)addr;
+            if ((!pHead->cs) || (!pHead->pName)) {
+                continue;
+            }
+            _init_name_insert(type, pHead);
+        }
+    }
+}
+
+/**
+ * @brief Add a new created object into the name hash index.
+ *
+ * @param type The kernel object type.
+ * @param pObject The object context, its head.cs and head.pName have been set.
+ */
+void init_name_register(_u8_t type, void *pObject)
+{
+    struct base_head *pHead = (struct base_head *)pObject;
+
+    if ((type >= INIT_SLOT_NUM) || (!pHead) || (!pHead->pName)) {
+        return;
+    }
+
+    if (!g_init_name.built) {
+        /* The first build collects it from the section table. */
+        return;
+    }
+    _init_name_insert(type, pHead);
+}
+
+/**
+ * @brief Remove a deleting object from the name hash index.
+ *
+ * @param type The kernel object type.
+ * @param pObject The object context, it must be called before the context is cleared.
+ */
+void init_name_unregister(_u8_t type, void *pObject)
+{
+    struct base_head *pHead = (struct base_head *)pObject;
+
+    if ((type >= INIT_SLOT_NUM) || (!pHead) || (!pHead->pName) || (!g_init_name.built)) {
+        return;
+    }
+
+    struct base_head **ppNext = &g_init_name.pBucket[_init_name_hash(type, pHead->pName)];
+    while (*ppNext) {
+        if (*ppNext == pHead) {
+            *ppNext = pHead->pHashNext;
+            pHead->pHashNext = NULL;
+            break;
+        }
+        ppNext = &(*ppNext)->pHashNext;
+    }
+}
+
+/**
+ * @brief Find the object of the kernel object type by its name.
+ *
+ * @param type The kernel object type.
+ * @param pName The object name string.
+ *
+ * @return The object context, NULL is not found.
+ */
+void *init_name_lookup(_u8_t type, const _char_t *pName)
+{
+    if ((type >= INIT_SLOT_NUM) || (!pName)) {
+        return NULL;
+    }
+
+    if (!g_init_name.built) {
+        _init_name_build();
+    }
+
+    struct base_head *pHead = g_init_name.pBucket[_init_name_hash(type, pName)];
+    while (pHead) {
+        if (_init_name_type_isMatch(type, pHead) && _init_name_isSame(pHead->pName, pName)) {
+            return (void *)pHead;
+        }
+        pHead = pHead->pHashNext;
+    }
+    return NULL;
+}
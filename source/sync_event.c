@@ -43,6 +43,203 @@ static _b_t _event_context_isInit(event_context_t *pCurEvt)
     return ((pCurEvt) ? (((pCurEvt->head.cs) ? (true) : (false))) : false);
 }
 
+/**
+ * @brief Find the lowest set bit position.
+ *
+ * @param bits The bits value, it must not be zero.
+ *
+ * @return The bit position.
+ */
+static _u8_t _event_bit_first(_u64_t bits)
+{
+    _u8_t pos = 0u;
+    _u32_t low = (_u32_t)bits;
+
+    if (!low) {
+        low = (_u32_t)(bits >> 32u);
+        pos = 32u;
+    }
+    if (!(low & 0xFFFFu)) {
+        low >>= 16u;
+        pos += 16u;
+    }
+    if (!(low & 0xFFu)) {
+        low >>= 8u;
+        pos += 8u;
+    }
+    if (!(low & 0xFu)) {
+        low >>= 4u;
+        pos += 4u;
+    }
+    if (!(low & 0x3u)) {
+        low >>= 2u;
+        pos += 2u;
+    }
+    if (!(low & 0x1u)) {
+        pos += 1u;
+    }
+    return pos;
+}
+
+/**
+ * @brief Calculate the triggered bits according to the event value changing.
+ *
+ * @param pCurEvent The pointer of the event context.
+ * @param val The new event value.
+ * @param changed The changed bits.
+ *
+ * @return The triggered bits.
+ */
+static _u64_t _event_trigger_calculate(event_context_t *pCurEvent, _u64_t val, _u64_t changed)
+{
+    _u64_t any, edge, level, trigger = 0u;
+
+    if (!changed) {
+        return trigger;
+    }
+
+    // Any position
+    any = pCurEvent->anyMask;
+
+    // Changings trigger.
+    trigger = any & changed;
+
+    // Edge position
+    edge = pCurEvent->modeMask;
+    edge &= ~pCurEvent->anyMask;
+
+    // Edge rise trigger.
+    trigger |= edge & val & pCurEvent->dirMask & changed;
+
+    // Edge fall trigger.
+    trigger |= edge & ~val & ~pCurEvent->dirMask & changed;
+
+    // Level position
+    level = ~pCurEvent->modeMask;
+    level &= ~pCurEvent->anyMask;
+
+    // Level high trigger.
+    trigger |= level & val & pCurEvent->dirMask & changed;
+
+    // Level low trigger.
+    trigger |= level & ~val & ~pCurEvent->dirMask & changed;
+
+    return trigger;
+}
+
+/**
+ * @brief Check if the triggered bits meet with the waiter listen option.
+ *
+ * @param pEvt_sch The pointer of the waiter schedule data.
+ * @param trigger The triggered bits.
+ *
+ * @return The true indicates the waiter can be reported.
+ */
+static _b_t _event_waiter_isMatched(event_sch_t *pEvt_sch, _u64_t trigger)
+{
+    _u64_t report = trigger & pEvt_sch->listen;
+
+    if (pEvt_sch->option == EVENT_WAIT_ALL_VAL) {
+        return (report == pEvt_sch->listen) ? true : false;
+    }
+    return (report) ? true : false;
+}
+
+/**
+ * @brief Record the blocking waiter into the bit index.
+ *
+ * @param pCurEvent The pointer of the event context.
+ * @param pCurTask The pointer of the blocking task.
+ * @param pEvt_sch The pointer of the waiter schedule data.
+ */
+static void _event_waiter_index(event_context_t *pCurEvent, struct schedule_task *pCurTask, event_sch_t *pEvt_sch)
+{
+    for (_u8_t i = 0u; i < EVENT_WAITER_INDEX_NUMBER; i++) {
+        if (pCurEvent->pWaiter[i]) {
+            continue;
+        }
+
+        pCurEvent->pWaiter[i] = pCurTask;
+        pEvt_sch->slot = i;
+
+        _u64_t bits = pEvt_sch->listen;
+        while (bits) {
+            pCurEvent->bitIndex[_event_bit_first(bits)] |= (_u8_t)B(i);
+            bits &= bits - 1u;
+        }
+        return;
+    }
+
+    /* The index is full, the set operation walks the whole blocking list instead */
+    pEvt_sch->slot = EVENT_WAITER_UNINDEXED;
+    pCurEvent->unindexed++;
+}
+
+/**
+ * @brief Remove the waiter from the bit index.
+ *
+ * @param pCurEvent The pointer of the event context.
+ * @param pEvt_sch The pointer of the waiter schedule data.
+ */
+static void _event_waiter_unindex(event_context_t *pCurEvent, event_sch_t *pEvt_sch)
+{
+    _u8_t slot = pEvt_sch->slot;
+
+    if (slot == EVENT_WAITER_RELEASED) {
+        return;
+    }
+    pEvt_sch->slot = EVENT_WAITER_RELEASED;
+
+    if (slot == EVENT_WAITER_UNINDEXED) {
+        if (pCurEvent->unindexed) {
+            pCurEvent->unindexed--;
+        }
+        return;
+    }
+
+    pCurEvent->pWaiter[slot] = NULL;
+    _u64_t bits = pEvt_sch->listen;
+    while (bits) {
+        pCurEvent->bitIndex[_event_bit_first(bits)] &= (_u8_t)~B(slot);
+        bits &= bits - 1u;
+    }
+}
+
+/**
+ * @brief Release the waiter index of the blocking threads which left the event without the set operation.
+ *
+ * It's invoked when a blocking thread left by the timeout, suspension or deletion, its schedule data is still valid here.
+ *
+ * @param pQueue The pointer of the event wait queue.
+ */
+void event_queue_refresh(wait_queue_t *pQueue)
+{
+    event_context_t *pCurEvent = (event_context_t *)CONTAINEROF(pQueue, event_context_t, q_list);
+
+    for (_u8_t i = 0u; i < EVENT_WAITER_INDEX_NUMBER; i++) {
+        struct schedule_task *pCurTask = pCurEvent->pWaiter[i];
+        if ((pCurTask) && (pCurTask->linker.pList != &pQueue->list)) {
+            _event_waiter_unindex(pCurEvent, (event_sch_t *)pCurTask->pPendData);
+        }
+    }
+
+    if (!pCurEvent->unindexed) {
+        return;
+    }
+
+    /* The left waiter out of the index isn't known, so the remaining ones are counted again */
+    _u8_t unindexed = 0u;
+    struct schedule_task *pCurTask = NULL;
+    list_iterator_t it = ITERATION_NULL;
+    list_iterator_init(&it, &pQueue->list);
+    while (list_iterator_next_condition(&it, (void *)&pCurTask)) {
+        if (((event_sch_t *)pCurTask->pPendData)->slot == EVENT_WAITER_UNINDEXED) {
+            unindexed++;
+        }
+    }
+    pCurEvent->unindexed = unindexed;
+}
+
 /**
  * @brief The event schedule routine execute the the pendsv context.
  *
@@ -59,51 +256,41 @@ static void _event_schedule(void *pTask)
         return;
     }
 
-    _u32_t changed, any, edge, level, trigger = 0u;
-    event_context_t *pCurEvent = (event_context_t *)pCurTask->pPendCtx;
+    /* The triggered bits was reported by the set operation already */
+    pCurTask->exec.entry.result = 0;
+}
+
+/**
+ * @brief Report the triggered bits to the blocking waiter if it meets with the listen option.
+ *
+ * @param pCurEvent The pointer of the event context.
+ * @param pCurTask The pointer of the blocking task.
+ * @param trigger The triggered bits.
+ * @param val The new event value.
+ * @param pReported The pointer of the reported bits.
+ *
+ * @return The result of the operation.
+ */
+static _i32p_t _event_waiter_report(event_context_t *pCurEvent, struct schedule_task *pCurTask, _u64_t trigger, _u64_t val,
+                                    _u64_t *pReported)
+{
     event_sch_t *pEvt_sche = (event_sch_t *)pCurTask->pPendData;
+
     if (!pEvt_sche) {
-        return;
+        return PC_EOR;
     }
-    changed = pEvt_sche->pEvtVal->value ^ pCurEvent->value;
-    if (changed) {
-        // Any position
-        any = pCurEvent->anyMask;
-
-        // Changings trigger.
-        trigger = any & changed;
 
-        // Edge position
-        edge = pCurEvent->modeMask;
-        edge &= ~pCurEvent->anyMask;
-
-        // Edge rise trigger.
-        trigger |= edge & pCurEvent->value & pCurEvent->dirMask & changed;
-
-        // Edge fall trigger.
-        trigger |= edge & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
-
-        // Level position
-        level = ~pCurEvent->modeMask;
-        level &= ~pCurEvent->anyMask;
-
-        // Level high trigger.
-        trigger |= level & pCurEvent->value & pCurEvent->dirMask & changed;
-
-        // Level low trigger.
-        trigger |= level & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
+    if (!_event_waiter_isMatched(pEvt_sche, trigger)) {
+        return 0;
     }
-    // Triggered bits
-    trigger |= pCurEvent->triggered;
 
-    pEvt_sche->pEvtVal->value = pCurEvent->value;
-    _u32_t report = trigger & pEvt_sche->listen;
-    if (report) {
-        pEvt_sche->pEvtVal->trigger = trigger;
-        pCurEvent->triggered &= ~report;
-    }
+    *pReported |= trigger & pEvt_sche->listen;
+    pEvt_sche->pEvtVal->trigger = trigger;
+    pEvt_sche->pEvtVal->value = val;
+    _event_waiter_unindex(pCurEvent, pEvt_sche);
+    timeout_remove(&pCurTask->expire, true);
 
-    pCurTask->exec.entry.result = 0;
+    return schedule_entry_trigger(pCurTask, _event_schedule, 0u);
 }
 
 /**
@@ -117,39 +304,34 @@ static _u32_t _event_init_privilege_routine(arguments_t *pArgs)
 {
     ENTER_CRITICAL_SECTION();
 
-    _u32_t anyMask = (_u32_t)(pArgs[0].u32_val);
-    _u32_t modeMask = (_u32_t)(pArgs[1].u32_val);
-    _u32_t dirMask = (_u32_t)(pArgs[2].u32_val);
-    _u32_t init = (_u32_t)(pArgs[3].u32_val);
+    _u64_t anyMask = *((_u64_t *)pArgs[0].pv_val);
+    _u64_t modeMask = *((_u64_t *)pArgs[1].pv_val);
+    _u64_t dirMask = *((_u64_t *)pArgs[2].pv_val);
+    _u64_t init = *((_u64_t *)pArgs[3].pv_val);
     const _char_t *pName = (const _char_t *)(pArgs[4].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_EVENT_LIST, event_context_t, pCurEvent)
-    {
-        if (_event_context_isInvalid(pCurEvent)) {
-            break;
-        }
-
-        if (_event_context_isInit(pCurEvent)) {
-            continue;
-        }
+    event_context_t *pCurEvent = (event_context_t *)init_slot_alloc(INIT_SLOT_EVENT);
+    if (!pCurEvent) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        k_memset((_char_t *)pCurEvent, 0x0u, sizeof(event_context_t));
-        pCurEvent->head.cs = CS_INITED;
-        pCurEvent->head.pName = pName;
+    k_memset((_char_t *)pCurEvent, 0x0u, sizeof(event_context_t));
+    pCurEvent->head.cs = CS_INITED;
+    pCurEvent->head.pName = pName;
 
-        pCurEvent->value = init;
-        pCurEvent->triggered = 0u;
-        pCurEvent->anyMask = anyMask;
-        pCurEvent->modeMask = modeMask;
-        pCurEvent->dirMask = dirMask;
-        pCurEvent->call.pEvtCallEntry = NULL;
+    pCurEvent->value = init;
+    pCurEvent->triggered = 0u;
+    pCurEvent->anyMask = anyMask;
+    pCurEvent->modeMask = modeMask;
+    pCurEvent->dirMask = dirMask;
+    pCurEvent->call.pEvtCallEntry = NULL;
+    pCurEvent->q_list.pRefreshFunc = event_queue_refresh;
 
-        EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurEvent;
-    };
+    init_name_register(INIT_SLOT_EVENT, pCurEvent);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurEvent;
 }
 
 /**
@@ -164,7 +346,7 @@ static _i32p_t _event_value_get_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     event_context_t *pCurEvent = (event_context_t *)pArgs[0].u32_val;
-    _u32_t *pValue = (_u32_t *)pArgs[1].pv_val;
+    _u64_t *pValue = (_u64_t *)pArgs[1].pv_val;
     *pValue = pCurEvent->value;
 
     EXIT_CRITICAL_SECTION();
@@ -183,12 +365,12 @@ static _i32p_t _event_set_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     event_context_t *pCurEvent = (event_context_t *)pArgs[0].u32_val;
-    _u32_t set = (_u32_t)pArgs[1].u32_val;
-    _u32_t clear = (_u32_t)pArgs[2].u32_val;
-    _u32_t toggle = (_u32_t)pArgs[3].u32_val;
+    _u64_t set = *((_u64_t *)pArgs[1].pv_val);
+    _u64_t clear = *((_u64_t *)pArgs[2].pv_val);
+    _u64_t toggle = *((_u64_t *)pArgs[3].pv_val);
 
-    _u32_t val = pCurEvent->value;
-    _u32_t changed, any, edge, level, trigger = 0u;
+    _u64_t val = pCurEvent->value;
+    _u64_t trigger = 0u;
     _i32p_t postcode = 0;
 
     /// Clear bits
@@ -198,59 +380,48 @@ static _i32p_t _event_set_privilege_routine(arguments_t *pArgs)
     // Toggle bits
     val ^= toggle;
 
-    changed = val ^ pCurEvent->value;
-
-    // Any position
-    any = pCurEvent->anyMask;
-
-    // Changings trigger.
-    trigger = any & changed;
-
-    // Edge position
-    edge = pCurEvent->modeMask;
-    edge &= ~pCurEvent->anyMask;
-
-    // Edge rise trigger.
-    trigger |= edge & val & pCurEvent->dirMask & changed;
-
-    // Edge fall trigger.
-    trigger |= edge & ~val & ~pCurEvent->dirMask & changed;
-
-    // Level position
-    level = ~pCurEvent->modeMask;
-    level &= ~pCurEvent->anyMask;
-
-    // Level high trigger.
-    trigger |= level & val & pCurEvent->dirMask & changed;
-
-    // Level low trigger.
-    trigger |= level & ~val & ~pCurEvent->dirMask & changed;
+    trigger = _event_trigger_calculate(pCurEvent, val, val ^ pCurEvent->value);
 
     // Triggered bits
     trigger |= pCurEvent->triggered;
 
-    _u32_t report, reported = 0u;
-    list_iterator_t it = {0u};
-    list_t *pList = (list_t *)&pCurEvent->q_list;
-    list_iterator_init(&it, pList);
-    struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
-    while (pCurTask) {
-        event_sch_t *pEvt_sche = (event_sch_t *)pCurTask->pPendData;
-        if (!pEvt_sche) {
-            return PC_EOR;
+    _u64_t reported = 0u;
+    if (pCurEvent->unindexed) {
+        list_iterator_t it = {0u};
+        list_t *pList = &pCurEvent->q_list.list;
+        list_iterator_init(&it, pList);
+        struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
+        while (pCurTask) {
+            postcode = _event_waiter_report(pCurEvent, pCurTask, trigger, val, &reported);
+            PC_IF(postcode, PC_ERROR)
+            {
+                break;
+            }
+            pCurTask = (struct schedule_task *)list_iterator_next(&it);
+        }
+    } else {
+        /* Only the waiters listen to the triggered bits are visited */
+        _u8_t candidate = 0u;
+        _u64_t bits = trigger;
+        while (bits) {
+            candidate |= pCurEvent->bitIndex[_event_bit_first(bits)];
+            bits &= bits - 1u;
         }
-        report = trigger & pEvt_sche->listen;
-        if (report) {
-            reported |= report;
-            pEvt_sche->pEvtVal->trigger = trigger;
-            pEvt_sche->pEvtVal->value = val;
-            postcode = schedule_entry_trigger(pCurTask, _event_schedule, 0u);
+
+        while (candidate) {
+            _u8_t slot = _event_bit_first(candidate);
+            struct schedule_task *pCurTask = pCurEvent->pWaiter[slot];
+            candidate &= candidate - 1u;
+
+            if (!pCurTask) {
+                continue;
+            }
+            postcode = _event_waiter_report(pCurEvent, pCurTask, trigger, val, &reported);
             PC_IF(postcode, PC_ERROR)
             {
                 break;
             }
         }
-        pCurTask = (struct schedule_task *)list_iterator_next(&it);
     }
     pCurEvent->triggered = (~reported) & trigger;
     pCurEvent->value = val;
@@ -275,54 +446,25 @@ static _i32p_t _event_wait_privilege_routine(arguments_t *pArgs)
     _u32_t timeout_ms = (_u32_t)pArgs[2].u32_val;
     _i32p_t postcode = 0;
 
-    thread_context_t *pCurThread = kernel_thread_runContextGet();
+    struct schedule_task *pCurTask = kernel_task_runGet();
     struct evt_val *pEvtData = pEvt_sch->pEvtVal;
-    _u32_t changed, any, edge, level, trigger = 0u;
-
-    changed = pEvtData->value ^ pCurEvent->value;
-    if (changed) {
-        // Any position
-        any = pCurEvent->anyMask;
-
-        // Changings trigger.
-        trigger = any & changed;
-
-        // Edge position
-        edge = pCurEvent->modeMask;
-        edge &= ~pCurEvent->anyMask;
-
-        // Edge rise trigger.
-        trigger |= edge & pCurEvent->value & pCurEvent->dirMask & changed;
-
-        // Edge fall trigger.
-        trigger |= edge & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
-
-        // Level position
-        level = ~pCurEvent->modeMask;
-        level &= ~pCurEvent->anyMask;
-
-        // Level high trigger.
-        trigger |= level & pCurEvent->value & pCurEvent->dirMask & changed;
-
-        // Level low trigger.
-        trigger |= level & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
-    }
+    _u64_t trigger = _event_trigger_calculate(pCurEvent, pCurEvent->value, pEvtData->value ^ pCurEvent->value);
 
     // Triggered bits
     trigger |= pCurEvent->triggered;
 
     pEvtData->value = pCurEvent->value;
-    _u32_t report = trigger & pEvt_sch->listen;
-    if (report) {
+    if (_event_waiter_isMatched(pEvt_sch, trigger)) {
         pEvtData->trigger = trigger;
-        pCurEvent->triggered &= ~report;
+        pCurEvent->triggered &= ~(trigger & pEvt_sch->listen);
 
         EXIT_CRITICAL_SECTION();
         return postcode;
     }
-    postcode = schedule_exit_trigger(&pCurThread->task, pCurEvent, pEvt_sch, &pCurEvent->q_list, timeout_ms, true);
+    postcode = schedule_exit_trigger(pCurTask, pCurEvent, pEvt_sch, &pCurEvent->q_list, timeout_ms, true);
     PC_IF(postcode, PC_PASS)
     {
+        _event_waiter_index(pCurEvent, pCurTask, pEvt_sch);
         postcode = PC_OS_WAIT_UNAVAILABLE;
     }
 
@@ -330,6 +472,29 @@ static _i32p_t _event_wait_privilege_routine(arguments_t *pArgs)
     return postcode;
 }
 
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _event_wait_order_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    event_context_t *pCurEvent = (event_context_t *)pArgs[0].u32_val;
+    _u8_t order = (_u8_t)pArgs[1].u8_val;
+    _i32p_t postcode = 0;
+
+    if (!schedule_wait_order_set(&pCurEvent->q_list, order)) {
+        postcode = PC_EOR;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -345,7 +510,7 @@ static _i32p_t _event_delete_privilege_routine(arguments_t *pArgs)
     _i32p_t postcode = 0;
 
     list_iterator_t it = {0u};
-    list_t *plist = (list_t *)&pCurEvent->q_list;
+    list_t *plist = &pCurEvent->q_list.list;
     list_iterator_init(&it, plist);
     struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
     while (pCurTask) {
@@ -355,7 +520,9 @@ static _i32p_t _event_delete_privilege_routine(arguments_t *pArgs)
         }
         pCurTask = (struct schedule_task *)list_iterator_next(&it);
     }
+    init_name_unregister(INIT_SLOT_EVENT, pCurEvent);
     k_memset((_char_t *)pCurEvent, 0x0u, sizeof(event_context_t));
+    init_slot_free(INIT_SLOT_EVENT, pCurEvent);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -372,16 +539,30 @@ static _i32p_t _event_delete_privilege_routine(arguments_t *pArgs)
  *
  * @return The event unique id.
  */
-_u32_t _impl_event_init(_u32_t anyMask, _u32_t modeMask, _u32_t dirMask, _u32_t init, const _char_t *pName)
+_u32_t _impl_event_init(_u64_t anyMask, _u64_t modeMask, _u64_t dirMask, _u64_t init, const _char_t *pName)
 {
     arguments_t arguments[] = {
-        [0] = {.u32_val = (_u32_t)anyMask}, [1] = {.u32_val = (_u32_t)modeMask},       [2] = {.u32_val = (_u32_t)dirMask},
-        [3] = {.u32_val = (_u32_t)init},    [4] = {.pch_val = (const _char_t *)pName},
+        [0] = {.pv_val = (void *)&anyMask}, [1] = {.pv_val = (void *)&modeMask},       [2] = {.pv_val = (void *)&dirMask},
+        [3] = {.pv_val = (void *)&init},    [4] = {.pch_val = (const _char_t *)pName},
     };
 
     return kernel_privilege_invoke((const void *)_event_init_privilege_routine, arguments);
 }
 
+/**
+ * @brief Find a event id by its name.
+ *
+ * @param pName The event name.
+ *
+ * @return The value of event unique id.
+ */
+_u32_t _impl_event_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_EVENT, pName);
+}
+
 /**
  * @brief Read or write the event signal value.
  *
@@ -390,7 +571,7 @@ _u32_t _impl_event_init(_u32_t anyMask, _u32_t modeMask, _u32_t dirMask, _u32_t
  *
  * @return The result of the operation.
  */
-_i32p_t _impl_event_value_get(_u32_t ctx, _u32_t *pValue)
+_i32p_t _impl_event_value_get(_u32_t ctx, _u64_t *pValue)
 {
     event_context_t *pCtx = (event_context_t *)ctx;
     if (_event_context_isInvalid(pCtx)) {
@@ -419,7 +600,7 @@ _i32p_t _impl_event_value_get(_u32_t ctx, _u32_t *pValue)
  *
  * @return The result of the operation.
  */
-_i32p_t _impl_event_set(_u32_t ctx, _u32_t set, _u32_t clear, _u32_t toggle)
+_i32p_t _impl_event_set(_u32_t ctx, _u64_t set, _u64_t clear, _u64_t toggle)
 {
     event_context_t *pCtx = (event_context_t *)ctx;
     if (_event_context_isInvalid(pCtx)) {
@@ -432,9 +613,9 @@ _i32p_t _impl_event_set(_u32_t ctx, _u32_t set, _u32_t clear, _u32_t toggle)
 
     arguments_t arguments[] = {
         [0] = {.u32_val = (_u32_t)ctx},
-        [1] = {.u32_val = (_u32_t)set},
-        [2] = {.u32_val = (_u32_t)clear},
-        [3] = {.u32_val = (_u32_t)toggle},
+        [1] = {.pv_val = (void *)&set},
+        [2] = {.pv_val = (void *)&clear},
+        [3] = {.pv_val = (void *)&toggle},
     };
 
     return kernel_privilege_invoke((const void *)_event_set_privilege_routine, arguments);
@@ -446,11 +627,12 @@ _i32p_t _impl_event_set(_u32_t ctx, _u32_t set, _u32_t clear, _u32_t toggle)
  * @param id The event unique id.
  * @param pEvtData The pointer of event value.
  * @param listen_mask Current thread listen which bits in the event.
+ * @param option Wait any of the listen bits triggered = 0, wait all of them = 1.
  * @param timeout_ms The event wait timeout setting.
  *
  * @return The result of the operation.
  */
-_i32p_t _impl_event_wait(_u32_t ctx, struct evt_val *pEvtData, _u32_t listen_mask, _u32_t timeout_ms)
+_i32p_t _impl_event_wait(_u32_t ctx, struct evt_val *pEvtData, _u64_t listen_mask, _u8_t option, _u32_t timeout_ms)
 {
     event_context_t *pCtx = (event_context_t *)ctx;
     if (_event_context_isInvalid(pCtx)) {
@@ -465,6 +647,10 @@ _i32p_t _impl_event_wait(_u32_t ctx, struct evt_val *pEvtData, _u32_t listen_mas
         return PC_EOR;
     }
 
+    if (!listen_mask) {
+        return PC_EOR;
+    }
+
     if (!timeout_ms) {
         return PC_EOR;
     }
@@ -475,25 +661,70 @@ _i32p_t _impl_event_wait(_u32_t ctx, struct evt_val *pEvtData, _u32_t listen_mas
 
     event_sch_t evt_sch = {
         .listen = listen_mask,
+        .option = option,
+        .slot = EVENT_WAITER_RELEASED,
         .pEvtVal = pEvtData,
     };
+    event_sch_t *pEvt_sch = &evt_sch;
+    struct stackless_task *pStackless = kernel_stackless_runGet();
+    if (pStackless) {
+        pStackless->pend.data.evt = evt_sch;
+        pEvt_sch = &pStackless->pend.data.evt;
+    }
+
     arguments_t arguments[] = {
         [0] = {.u32_val = (_u32_t)ctx},
-        [1] = {.pv_val = (void *)&evt_sch},
+        [1] = {.pv_val = (void *)pEvt_sch},
         [2] = {.u32_val = (_u32_t)timeout_ms},
     };
 
     _i32p_t postcode = kernel_privilege_invoke((const void *)_event_wait_privilege_routine, arguments);
 
+    if (pStackless) {
+        return postcode;
+    }
+
     ENTER_CRITICAL_SECTION();
 
     if (postcode == PC_OS_WAIT_UNAVAILABLE) {
         postcode = kernel_schedule_result_take();
     }
     EXIT_CRITICAL_SECTION();
+
     return postcode;
 }
 
+/**
+ * @brief Set the blocking threads waiting order of the event, it's allowed when no thread is blocking.
+ *
+ * @param id The event unique id.
+ * @param order The waiting order, the priority or the arrival order.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_event_wait_order_set(_u32_t ctx, _u8_t order)
+{
+    event_context_t *pCtx = (event_context_t *)ctx;
+    if (_event_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_event_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((order != WAIT_ORDER_PRIORITY_VAL) && (order != WAIT_ORDER_FIFO_VAL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u8_val = (_u8_t)order},
+    };
+
+    return kernel_privilege_invoke((const void *)_event_wait_order_set_privilege_routine, arguments);
+}
+
 /**
  * @brief Event delete.
  *
@@ -12,7 +12,8 @@
 /**
  * Local unique postcode.
  */
-#define PC_EOR PC_IER(PC_OS_CMPT_MUTEX_5)
+#define PC_EOR         PC_IER(PC_OS_CMPT_MUTEX_5)
+#define _MUTEX_DELETED (12u)
 
 /**
  * @brief Check if the mutex unique id if is's invalid.
@@ -42,6 +43,81 @@ static _b_t _mutex_context_isInit(mutex_context_t *pCurMutex)
     return ((pCurMutex) ? (((pCurMutex->head.cs) ? (true) : (false))) : false);
 }
 
+/**
+ * @brief Set the holder of the mutex, the mutex is linked into its hold list.
+ *
+ * @param pCurMutex The pointer of the mutex context.
+ * @param pCurTask The pointer of the holder task.
+ */
+static void _mutex_holder_set(mutex_context_t *pCurMutex, struct schedule_task *pCurTask)
+{
+    pCurMutex->pHoldTask = pCurTask;
+    pCurMutex->locked = true;
+    pCurMutex->hold.pQueue[0] = &pCurMutex->q_list;
+    schedule_lock_hold(pCurTask, &pCurMutex->hold);
+}
+
+/**
+ * @brief Release the mutex and hand it over to the next blocking thread.
+ *
+ * @param pCurMutex The pointer of the mutex context.
+ *
+ * @return The result of the operation.
+ */
+static _i32p_t _mutex_ownership_release(mutex_context_t *pCurMutex)
+{
+    _i32p_t postcode = 0;
+
+    struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurMutex->q_list.list);
+    struct schedule_task *pLockTask = pCurMutex->pHoldTask;
+
+    /* priority recovery */
+    pCurMutex->pHoldTask = NULL;
+    pCurMutex->locked = false;
+    schedule_lock_release(pLockTask, &pCurMutex->hold);
+
+    if (pCurTask) {
+        /* The next thread take the ticket */
+        _mutex_holder_set(pCurMutex, pCurTask);
+        postcode = schedule_entry_trigger(pCurTask, NULL, 0u);
+    }
+
+    return postcode;
+}
+
+/**
+ * @brief The condition schedule routine execute the the pendsv context.
+ *
+ * @param id The unique id of the entry thread.
+ */
+static void _mutex_cond_schedule(void *pTask)
+{
+    struct schedule_task *pCurTask = (struct schedule_task *)pTask;
+    struct call_entry *pEntry = &pCurTask->exec.entry;
+
+    timeout_remove(&pCurTask->expire, true);
+
+    if (pEntry->result == _MUTEX_DELETED) {
+        pEntry->result = PC_OS_WAIT_NODATA;
+        return;
+    }
+
+    mutex_context_t *pCurMutex = (mutex_context_t *)pCurTask->pPendCtx;
+    if (pCurMutex->locked == true) {
+        /* Keep it blocking until the holder unlock and hand the ticket over */
+        struct schedule_task *pLockTask = pCurMutex->pHoldTask;
+        if (pCurTask->prior < pLockTask->prior) {
+            schedule_priority_set(pLockTask, pCurTask->prior);
+        }
+        schedule_entry_redirect(pCurTask, pCurMutex, &pCurMutex->q_list);
+        return;
+    }
+
+    /* Re-acquire the mutex before the thread run */
+    _mutex_holder_set(pCurMutex, pCurTask);
+    pEntry->result = 0;
+}
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -55,30 +131,23 @@ static _u32_t _mutex_init_privilege_routine(arguments_t *pArgs)
 
     const _char_t *pName = (const _char_t *)(pArgs[0].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_MUTEX_LIST, mutex_context_t, pCurMutex)
-    {
-        if (_mutex_context_isInvalid(pCurMutex)) {
-            break;
-        }
-
-        if (_mutex_context_isInit(pCurMutex)) {
-            continue;
-        }
+    mutex_context_t *pCurMutex = (mutex_context_t *)init_slot_alloc(INIT_SLOT_MUTEX);
+    if (!pCurMutex) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        k_memset((_char_t *)pCurMutex, 0x0u, sizeof(mutex_context_t));
-        pCurMutex->head.cs = CS_INITED;
-        pCurMutex->head.pName = pName;
+    k_memset((_char_t *)pCurMutex, 0x0u, sizeof(mutex_context_t));
+    pCurMutex->head.cs = CS_INITED;
+    pCurMutex->head.pName = pName;
 
-        pCurMutex->locked = false;
-        pCurMutex->pHoldTask = NULL;
-        pCurMutex->originalPriority = OS_PRIOTITY_INVALID_LEVEL;
+    pCurMutex->locked = false;
+    pCurMutex->pHoldTask = NULL;
 
-        EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurMutex;
-    }
+    init_name_register(INIT_SLOT_MUTEX, pCurMutex);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurMutex;
 }
 
 /**
@@ -100,7 +169,7 @@ static _i32p_t _mutex_lock_privilege_routine(arguments_t *pArgs)
     if (pCurMutex->locked == true) {
         struct schedule_task *pLockTask = pCurMutex->pHoldTask;
         if (pCurThread->task.prior < pLockTask->prior) {
-            pLockTask->prior = pCurThread->task.prior;
+            schedule_priority_set(pLockTask, pCurThread->task.prior);
         }
         postcode = schedule_exit_trigger(&pCurThread->task, pCurMutex, NULL, &pCurMutex->q_list, 0u, true);
 
@@ -109,9 +178,7 @@ static _i32p_t _mutex_lock_privilege_routine(arguments_t *pArgs)
     }
 
     /* Highest priority inheritance */
-    pCurMutex->pHoldTask = &pCurThread->task;
-    pCurMutex->originalPriority = pCurThread->task.prior;
-    pCurMutex->locked = true;
+    _mutex_holder_set(pCurMutex, &pCurThread->task);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -129,22 +196,104 @@ static _i32p_t _mutex_unlock_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     mutex_context_t *pCurMutex = (mutex_context_t *)pArgs[0].u32_val;
+    _i32p_t postcode = _mutex_ownership_release(pCurMutex);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _mutex_cond_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    mutex_context_t *pCurMutex = (mutex_context_t *)pArgs[0].u32_val;
+    _u32_t timeout_ms = (_u32_t)pArgs[1].u32_val;
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
     _i32p_t postcode = 0;
 
-    struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurMutex->q_list);
-    struct schedule_task *pLockTask = pCurMutex->pHoldTask;
-    /* priority recovery */
-    pLockTask->prior = pCurMutex->originalPriority;
-    if (!pCurTask) {
-        // no blocking thread
-        pCurMutex->originalPriority = OS_PRIOTITY_INVALID_LEVEL;
-        pCurMutex->pHoldTask = NULL;
-        pCurMutex->locked = false;
+    if ((pCurMutex->locked == false) || (pCurMutex->pHoldTask != &pCurThread->task)) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    /* Unlock and block in the same privilege call */
+    postcode = _mutex_ownership_release(pCurMutex);
+    PC_IF(postcode, PC_PASS_INFO)
+    {
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurMutex, NULL, &pCurMutex->cond_QList, timeout_ms, true);
+        PC_IF(postcode, PC_PASS)
+        {
+            postcode = PC_OS_WAIT_UNAVAILABLE;
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _mutex_cond_signal_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    mutex_context_t *pCurMutex = (mutex_context_t *)pArgs[0].u32_val;
+    _b_t broadcast = (_b_t)pArgs[1].b_val;
+    _i32p_t postcode = 0;
+
+    list_iterator_t it = {0u};
+    list_t *plist = &pCurMutex->cond_QList.list;
+    list_iterator_init(&it, plist);
+    struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
+    while (pCurTask) {
+        postcode = schedule_entry_trigger(pCurTask, _mutex_cond_schedule, 0u);
+        PC_IF(postcode, PC_ERROR)
+        {
+            break;
+        }
+
+        if (!broadcast) {
+            break;
+        }
+        pCurTask = (struct schedule_task *)list_iterator_next(&it);
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _mutex_wait_order_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    mutex_context_t *pCurMutex = (mutex_context_t *)pArgs[0].u32_val;
+    _u8_t order = (_u8_t)pArgs[1].u8_val;
+    _i32p_t postcode = 0;
+
+    if ((pCurMutex->q_list.list.pHead) || (pCurMutex->cond_QList.list.pHead)) {
+        postcode = PC_EOR;
     } else {
-        /* The next thread take the ticket */
-        pCurMutex->pHoldTask = pCurTask;
-        pCurMutex->originalPriority = pCurTask->prior;
-        postcode = schedule_entry_trigger(pCurTask, NULL, 0u);
+        schedule_wait_order_set(&pCurMutex->q_list, order);
+        schedule_wait_order_set(&pCurMutex->cond_QList, order);
     }
 
     EXIT_CRITICAL_SECTION();
@@ -166,7 +315,7 @@ static _i32p_t _mutex_delete_privilege_routine(arguments_t *pArgs)
     _i32p_t postcode = 0;
 
     list_iterator_t it = {0u};
-    list_t *plist = (list_t *)&pCurMutex->q_list;
+    list_t *plist = &pCurMutex->q_list.list;
     list_iterator_init(&it, plist);
     struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
     while (pCurTask) {
@@ -176,7 +325,29 @@ static _i32p_t _mutex_delete_privilege_routine(arguments_t *pArgs)
         }
         pCurTask = (struct schedule_task *)list_iterator_next(&it);
     }
+
+    plist = &pCurMutex->cond_QList.list;
+    list_iterator_init(&it, plist);
+    pCurTask = (struct schedule_task *)list_iterator_next(&it);
+    while (pCurTask) {
+        postcode = schedule_entry_trigger(pCurTask, _mutex_cond_schedule, _MUTEX_DELETED);
+        PC_IF(postcode, PC_ERROR)
+        {
+            break;
+        }
+        pCurTask = (struct schedule_task *)list_iterator_next(&it);
+    }
+
+    struct schedule_task *pLockTask = pCurMutex->pHoldTask;
+    if (pLockTask) {
+        /* priority recovery */
+        pCurMutex->pHoldTask = NULL;
+        pCurMutex->locked = false;
+        schedule_lock_release(pLockTask, &pCurMutex->hold);
+    }
+    init_name_unregister(INIT_SLOT_MUTEX, pCurMutex);
     k_memset((_char_t *)pCurMutex, 0x0u, sizeof(mutex_context_t));
+    init_slot_free(INIT_SLOT_MUTEX, pCurMutex);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -198,6 +369,20 @@ _u32_t _impl_mutex_init(const _char_t *pName)
     return kernel_privilege_invoke((const void *)_mutex_init_privilege_routine, arguments);
 }
 
+/**
+ * @brief Find a mutex id by its name.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The value of mutex unique id.
+ */
+_u32_t _impl_mutex_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_MUTEX, pName);
+}
+
 /**
  * @brief Mutex lock to avoid another thread access this resource.
  *
@@ -252,6 +437,37 @@ _i32p_t _impl_mutex_unlock(_u32_t ctx)
     return kernel_privilege_invoke((const void *)_mutex_unlock_privilege_routine, arguments);
 }
 
+/**
+ * @brief Set the blocking threads waiting order of the mutex, it's allowed when no thread is blocking.
+ *
+ * @param id The mutex unique id.
+ * @param order The waiting order, the priority or the arrival order.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_mutex_wait_order_set(_u32_t ctx, _u8_t order)
+{
+    mutex_context_t *pCtx = (mutex_context_t *)ctx;
+    if (_mutex_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_mutex_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((order != WAIT_ORDER_PRIORITY_VAL) && (order != WAIT_ORDER_FIFO_VAL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u8_val = (_u8_t)order},
+    };
+
+    return kernel_privilege_invoke((const void *)_mutex_wait_order_set_privilege_routine, arguments);
+}
+
 /**
  * @brief Mutex delete.
  *
@@ -276,3 +492,107 @@ _i32p_t _impl_mutex_delete(_u32_t ctx)
 
     return kernel_privilege_invoke((const void *)_mutex_delete_privilege_routine, arguments);
 }
+
+/**
+ * @brief Condition wait to unlock the mutex and block until it's signaled.
+ *
+ * @param ctx The mutex unique id.
+ * @param timeout_ms The blocking timeout value.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_mutex_cond_wait(_u32_t ctx, _u32_t timeout_ms)
+{
+    mutex_context_t *pCtx = (mutex_context_t *)ctx;
+    if (_mutex_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_mutex_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u32_val = (_u32_t)timeout_ms},
+    };
+
+    _i32p_t postcode = kernel_privilege_invoke((const void *)_mutex_cond_wait_privilege_routine, arguments);
+
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
+
+    EXIT_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_TIMEOUT) {
+        /* The timeout path didn't pass the entry callback, the mutex has to be locked again */
+        PC_IF(_impl_mutex_lock(ctx), PC_ERROR)
+        {
+            return PC_EOR;
+        }
+    }
+    return postcode;
+}
+
+/**
+ * @brief Condition signal to wake up the highest priority waiting thread.
+ *
+ * @param ctx The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_mutex_cond_signal(_u32_t ctx)
+{
+    mutex_context_t *pCtx = (mutex_context_t *)ctx;
+    if (_mutex_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_mutex_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.b_val = false},
+    };
+
+    return kernel_privilege_invoke((const void *)_mutex_cond_signal_privilege_routine, arguments);
+}
+
+/**
+ * @brief Condition broadcast to wake up all waiting threads.
+ *
+ * @param ctx The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_mutex_cond_broadcast(_u32_t ctx)
+{
+    mutex_context_t *pCtx = (mutex_context_t *)ctx;
+    if (_mutex_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_mutex_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.b_val = true},
+    };
+
+    return kernel_privilege_invoke((const void *)_mutex_cond_signal_privilege_routine, arguments);
+}
@@ -0,0 +1,584 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "sched_kernel.h"
+#include "sched_timer.h"
+#include "k_trace.h"
+#include "postcode.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR          PC_IER(PC_OS_CMPT_RWLOCK_11)
+#define _RWLOCK_DELETED (12u)
+
+/**
+ * @brief Check if the rwlock unique id if is's invalid.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is invalid, otherwise is valid.
+ */
+static _b_t _rwlock_context_isInvalid(rwlock_context_t *pCurRwlock)
+{
+    _u32_t start, end;
+    INIT_SECTION_FIRST(INIT_SECTION_OS_RWLOCK_LIST, start);
+    INIT_SECTION_LAST(INIT_SECTION_OS_RWLOCK_LIST, end);
+
+    return ((_u32_t)pCurRwlock < start || (_u32_t)pCurRwlock >= end) ? true : false;
+}
+
+/**
+ * @brief Check if the rwlock object if is's initialized.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is initialized, otherwise is uninitialized.
+ */
+static _b_t _rwlock_context_isInit(rwlock_context_t *pCurRwlock)
+{
+    return ((pCurRwlock) ? (((pCurRwlock->head.cs) ? (true) : (false))) : false);
+}
+
+/**
+ * @brief Find the holder slot of a reader thread.
+ *
+ * @param pCurRwlock The pointer of the rwlock context.
+ * @param pTask The pointer of the reader task, the NULL finds a free slot.
+ *
+ * @return The pointer of the holder slot, or NULL if it's not found.
+ */
+static struct rwlock_reader *_rwlock_reader_get(rwlock_context_t *pCurRwlock, struct schedule_task *pTask)
+{
+    for (_u8_t i = 0u; i < RWLOCK_READER_NUMBER_SUPPORTED; i++) {
+        if (pCurRwlock->reader[i].pTask == pTask) {
+            return &pCurRwlock->reader[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief The rwlock schedule routine execute the the pendsv context.
+ *
+ * @param id The unique id of the entry thread.
+ */
+static void _rwlock_schedule(void *pTask)
+{
+    struct schedule_task *pCurTask = (struct schedule_task *)pTask;
+    struct call_entry *pEntry = &pCurTask->exec.entry;
+
+    timeout_remove(&pCurTask->expire, true);
+
+    if (pEntry->result == _RWLOCK_DELETED) {
+        pEntry->result = PC_OS_WAIT_NODATA;
+    } else {
+        /* The ownership was handed over by the releaser already */
+        pEntry->result = 0;
+    }
+}
+
+/**
+ * @brief Set the writer of the rwlock, the rwlock is linked into its hold list.
+ *
+ * @param pCurRwlock The pointer of the rwlock context.
+ * @param pCurTask The pointer of the writer task.
+ */
+static void _rwlock_writer_set(rwlock_context_t *pCurRwlock, struct schedule_task *pCurTask)
+{
+    pCurRwlock->pWriteTask = pCurTask;
+    pCurRwlock->hold.pQueue[0] = &pCurRwlock->r_QList;
+    pCurRwlock->hold.pQueue[1] = &pCurRwlock->w_QList;
+    schedule_lock_hold(pCurTask, &pCurRwlock->hold);
+}
+
+/**
+ * @brief Raise the writer priority to the blocking thread priority.
+ *
+ * @param pCurRwlock The pointer of the rwlock context.
+ * @param pCurTask The pointer of the blocking task.
+ */
+static void _rwlock_writer_priority_inherit(rwlock_context_t *pCurRwlock, struct schedule_task *pCurTask)
+{
+    struct schedule_task *pWriteTask = pCurRwlock->pWriteTask;
+    if (!pWriteTask) {
+        return;
+    }
+
+    if (pCurTask->prior < pWriteTask->prior) {
+        schedule_priority_set(pWriteTask, pCurTask->prior);
+    }
+}
+
+/**
+ * @brief Hand the released rwlock to the next waiting writer or all waiting readers.
+ *
+ * @param pCurRwlock The pointer of the rwlock context.
+ *
+ * @return The result of the operation.
+ */
+static _i32p_t _rwlock_ownership_handover(rwlock_context_t *pCurRwlock)
+{
+    _i32p_t postcode = 0;
+
+    if (pCurRwlock->pWriteTask) {
+        return postcode;
+    }
+
+    struct schedule_task *pWriteTask = (struct schedule_task *)list_head(&pCurRwlock->w_QList.list);
+    struct schedule_task *pReadTask = (struct schedule_task *)list_head(&pCurRwlock->r_QList.list);
+    if ((pWriteTask) && ((pCurRwlock->writerPrefer) || (!pReadTask))) {
+        /* The writer waits for the holding readers */
+        if (pCurRwlock->readers) {
+            return postcode;
+        }
+
+        /* The next writer take the ticket */
+        timeout_remove(&pWriteTask->expire, true);
+        _rwlock_writer_set(pCurRwlock, pWriteTask);
+        return schedule_entry_trigger(pWriteTask, _rwlock_schedule, 0u);
+    }
+
+    /* The waiting readers take the free holder slots together, the entry list is drained in the same pendsv pass */
+    list_iterator_t it = ITERATION_NULL;
+    list_iterator_init(&it, &pCurRwlock->r_QList.list);
+    while (list_iterator_next_condition(&it, (void *)&pReadTask)) {
+        struct rwlock_reader *pReader = _rwlock_reader_get(pCurRwlock, NULL);
+        if (!pReader) {
+            break;
+        }
+
+        timeout_remove(&pReadTask->expire, true);
+        pReader->pTask = pReadTask;
+        pReader->count = 1u;
+        pCurRwlock->readers++;
+        postcode = schedule_entry_trigger(pReadTask, _rwlock_schedule, 0u);
+        PC_IF(postcode, PC_ERROR)
+        {
+            break;
+        }
+    }
+
+    return postcode;
+}
+
+/**
+ * @brief Re-check the rwlock after a blocking thread left by the timeout or suspension, or was repositioned.
+ *
+ * The readers queued behind a writer that is gone take the free rwlock, and the holding writer drops the priority
+ * that was inherited from the gone thread.
+ *
+ * @param pCurRwlock The pointer of the rwlock context.
+ */
+static void _rwlock_queue_refresh(rwlock_context_t *pCurRwlock)
+{
+    ENTER_CRITICAL_SECTION();
+
+    if (pCurRwlock->pWriteTask) {
+        schedule_priority_recover(pCurRwlock->pWriteTask);
+    } else {
+        _rwlock_ownership_handover(pCurRwlock);
+    }
+
+    EXIT_CRITICAL_SECTION();
+}
+
+/**
+ * @brief The refresh hook of the rwlock readers wait queue.
+ *
+ * @param pQueue The pointer of the readers wait queue.
+ */
+void rwlock_read_queue_refresh(wait_queue_t *pQueue)
+{
+    _rwlock_queue_refresh((rwlock_context_t *)CONTAINEROF(pQueue, rwlock_context_t, r_QList));
+}
+
+/**
+ * @brief The refresh hook of the rwlock writers wait queue.
+ *
+ * @param pQueue The pointer of the writers wait queue.
+ */
+void rwlock_write_queue_refresh(wait_queue_t *pQueue)
+{
+    _rwlock_queue_refresh((rwlock_context_t *)CONTAINEROF(pQueue, rwlock_context_t, w_QList));
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _u32_t _rwlock_init_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    _b_t writerPrefer = (_b_t)(pArgs[0].b_val);
+    const _char_t *pName = (const _char_t *)(pArgs[1].pch_val);
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)init_slot_alloc(INIT_SLOT_RWLOCK);
+    if (!pCurRwlock) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
+
+    k_memset((_char_t *)pCurRwlock, 0x0u, sizeof(rwlock_context_t));
+    pCurRwlock->head.cs = CS_INITED;
+    pCurRwlock->head.pName = pName;
+
+    pCurRwlock->writerPrefer = writerPrefer;
+    pCurRwlock->readers = 0u;
+    pCurRwlock->pWriteTask = NULL;
+    pCurRwlock->r_QList.pRefreshFunc = rwlock_read_queue_refresh;
+    pCurRwlock->w_QList.pRefreshFunc = rwlock_write_queue_refresh;
+
+    init_name_register(INIT_SLOT_RWLOCK, pCurRwlock);
+
+    EXIT_CRITICAL_SECTION();
+    return (_u32_t)pCurRwlock;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _rwlock_read_lock_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+    _u32_t timeout_ms = (_u32_t)pArgs[1].u32_val;
+    thread_context_t *pCurThread = NULL;
+    _i32p_t postcode = 0;
+
+    pCurThread = kernel_thread_runContextGet();
+    struct rwlock_reader *pReader = _rwlock_reader_get(pCurRwlock, &pCurThread->task);
+    if (pReader) {
+        /* The holding reader enters again, it mustn't wait behind the writer that is waiting for itself */
+        pReader->count++;
+        pCurRwlock->readers++;
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    pReader = _rwlock_reader_get(pCurRwlock, NULL);
+    if ((!pReader) || (pCurRwlock->pWriteTask) || ((pCurRwlock->writerPrefer) && (list_head(&pCurRwlock->w_QList.list)))) {
+        _rwlock_writer_priority_inherit(pCurRwlock, &pCurThread->task);
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurRwlock, NULL, &pCurRwlock->r_QList, timeout_ms, true);
+        PC_IF(postcode, PC_PASS)
+        {
+            postcode = PC_OS_WAIT_UNAVAILABLE;
+        }
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    pReader->pTask = &pCurThread->task;
+    pReader->count = 1u;
+    pCurRwlock->readers++;
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _rwlock_write_lock_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+    _u32_t timeout_ms = (_u32_t)pArgs[1].u32_val;
+    thread_context_t *pCurThread = NULL;
+    _i32p_t postcode = 0;
+
+    pCurThread = kernel_thread_runContextGet();
+    if ((pCurRwlock->pWriteTask) || (pCurRwlock->readers)) {
+        _rwlock_writer_priority_inherit(pCurRwlock, &pCurThread->task);
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurRwlock, NULL, &pCurRwlock->w_QList, timeout_ms, true);
+        PC_IF(postcode, PC_PASS)
+        {
+            postcode = PC_OS_WAIT_UNAVAILABLE;
+        }
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    _rwlock_writer_set(pCurRwlock, &pCurThread->task);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _rwlock_unlock_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
+    _i32p_t postcode = 0;
+
+    if (pCurRwlock->pWriteTask == &pCurThread->task) {
+        /* priority recovery */
+        pCurRwlock->pWriteTask = NULL;
+        schedule_lock_release(&pCurThread->task, &pCurRwlock->hold);
+    } else {
+        /* Only the reader thread holding the lock releases its own read lock */
+        struct rwlock_reader *pReader = _rwlock_reader_get(pCurRwlock, &pCurThread->task);
+        if (!pReader) {
+            EXIT_CRITICAL_SECTION();
+            return PC_EOR;
+        }
+
+        pReader->count--;
+        if (!pReader->count) {
+            pReader->pTask = NULL;
+        }
+        pCurRwlock->readers--;
+    }
+
+    postcode = _rwlock_ownership_handover(pCurRwlock);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _rwlock_delete_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+    _i32p_t postcode = 0;
+
+    struct schedule_task *pWriteTask = pCurRwlock->pWriteTask;
+    if (pWriteTask) {
+        /* priority recovery */
+        pCurRwlock->pWriteTask = NULL;
+        schedule_lock_release(pWriteTask, &pCurRwlock->hold);
+    }
+
+    list_t *pQList[] = {&pCurRwlock->r_QList.list, &pCurRwlock->w_QList.list};
+    for (_u8_t i = 0u; i < (sizeof(pQList) / sizeof(list_t *)); i++) {
+        list_iterator_t it = {0u};
+        list_iterator_init(&it, pQList[i]);
+        struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
+        while (pCurTask) {
+            postcode = schedule_entry_trigger(pCurTask, _rwlock_schedule, _RWLOCK_DELETED);
+            PC_IF(postcode, PC_ERROR)
+            {
+                break;
+            }
+            pCurTask = (struct schedule_task *)list_iterator_next(&it);
+        }
+    }
+    init_name_unregister(INIT_SLOT_RWLOCK, pCurRwlock);
+    k_memset((_char_t *)pCurRwlock, 0x0u, sizeof(rwlock_context_t));
+    init_slot_free(INIT_SLOT_RWLOCK, pCurRwlock);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Initialize a new rwlock.
+ *
+ * @param writerPrefer The new readers wait behind the blocking writers when it's true.
+ * @param pName The rwlock name.
+ *
+ * @return The rwlock unique id.
+ */
+_u32_t _impl_rwlock_init(_b_t writerPrefer, const _char_t *pName)
+{
+    arguments_t arguments[] = {
+        [0] = {.b_val = (_b_t)writerPrefer},
+        [1] = {.pch_val = (const _char_t *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_rwlock_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Find a rwlock id by its name.
+ *
+ * @param pName The rwlock name.
+ *
+ * @return The value of rwlock unique id.
+ */
+_u32_t _impl_rwlock_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_RWLOCK, pName);
+}
+
+/**
+ * @brief Rwlock shared lock with timeout option.
+ *
+ * @param ctx The rwlock unique id.
+ * @param timeout_ms The blocking timeout value.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_rwlock_read_lock(_u32_t ctx, _u32_t timeout_ms)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u32_val = (_u32_t)timeout_ms},
+    };
+
+    _i32p_t postcode = kernel_privilege_invoke((const void *)_rwlock_read_lock_privilege_routine, arguments);
+
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Rwlock exclusive lock with timeout option.
+ *
+ * @param ctx The rwlock unique id.
+ * @param timeout_ms The blocking timeout value.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_rwlock_write_lock(_u32_t ctx, _u32_t timeout_ms)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u32_val = (_u32_t)timeout_ms},
+    };
+
+    _i32p_t postcode = kernel_privilege_invoke((const void *)_rwlock_write_lock_privilege_routine, arguments);
+
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Rwlock unlock to release the shared or exclusive access.
+ *
+ * @param ctx The rwlock unique id.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_rwlock_unlock(_u32_t ctx)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+    };
+
+    return kernel_privilege_invoke((const void *)_rwlock_unlock_privilege_routine, arguments);
+}
+
+/**
+ * @brief Rwlock delete.
+ *
+ * @param ctx The rwlock unique id.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_rwlock_delete(_u32_t ctx)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+    };
+
+    return kernel_privilege_invoke((const void *)_rwlock_delete_privilege_routine, arguments);
+}
@@ -12,8 +12,7 @@
 /**
  * Local unique postcode.
  */
-#define PC_EOR             PC_IER(PC_OS_CMPT_SEMAPHORE_4)
-#define _SEMAPHORE_DELETED (12u)
+#define PC_EOR PC_IER(PC_OS_CMPT_SEMAPHORE_4)
 
 /**
  * @brief Check if the semaphore unique id if is's invalid.
@@ -44,25 +43,70 @@ static _b_t _semaphore_context_isInit(semaphore_context_t *pCurSemaphore)
 }
 
 /**
- * @brief The semaphore schedule routine execute the the pendsv context.
+ * @brief Wake up the blocking thread with the result directly, it has no deferred pendsv callback.
  *
- * @param id The unique id of the entry thread.
+ * @param pCurTask The pointer of the blocking thread task.
+ * @param result The result of the semaphore take operation.
+ *
+ * @return The result of the operation.
  */
-static void _semaphore_schedule(void *pTask)
+static _i32p_t _semaphore_wakeup(struct schedule_task *pCurTask, _i32p_t result)
 {
-    struct schedule_task *pCurTask = (struct schedule_task *)pTask;
-    struct call_entry *pEntry = &pCurTask->exec.entry;
-
     timeout_remove(&pCurTask->expire, true);
 
-    if (pEntry->result == _SEMAPHORE_DELETED) {
-        pEntry->result = PC_OS_WAIT_NODATA;
-    } else {
-        semaphore_context_t *pCurSemaphore = (semaphore_context_t *)pCurTask->pPendCtx;
-        /* If the PC arrive, the semaphore will be available and can be acquired */
-        pCurSemaphore->remains--; // The semaphore has available count
-        pCurTask->exec.entry.result = 0;
+    return schedule_entry_trigger(pCurTask, NULL, (_u32_t)result);
+}
+
+/**
+ * @brief Hand the available count over to the blocking threads in the priority order.
+ *
+ * @param pCurSemaphore The pointer of the semaphore context.
+ *
+ * @return The result of the operation.
+ */
+static _i32p_t _semaphore_ticket_handover(semaphore_context_t *pCurSemaphore)
+{
+    _i32p_t postcode = 0;
+    struct schedule_task *pCurTask = NULL;
+
+    list_iterator_t it = ITERATION_NULL;
+    list_iterator_init(&it, &pCurSemaphore->q_list.list);
+    while (list_iterator_next_condition(&it, (void *)&pCurTask)) {
+        _u32_t count = *((_u32_t *)pCurTask->pPendData);
+        if (pCurSemaphore->remains < count) {
+            /* The higher priority thread is served first */
+            break;
+        }
+
+        /* The requested count is consumed by the giver */
+        pCurSemaphore->remains -= count;
+        postcode = _semaphore_wakeup(pCurTask, 0);
+        PC_IF(postcode, PC_ERROR)
+        {
+            break;
+        }
+    }
+
+    return postcode;
+}
+
+/**
+ * @brief Hand the available count over again after a blocking thread left by the timeout or suspension.
+ *
+ * The head thread that stopped the handover may be gone, so the next ones mustn't miss the available count.
+ *
+ * @param pQueue The pointer of the semaphore wait queue.
+ */
+void semaphore_queue_refresh(wait_queue_t *pQueue)
+{
+    ENTER_CRITICAL_SECTION();
+
+    semaphore_context_t *pCurSemaphore = (semaphore_context_t *)CONTAINEROF(pQueue, semaphore_context_t, q_list);
+    if (pCurSemaphore->remains) {
+        _semaphore_ticket_handover(pCurSemaphore);
     }
+
+    EXIT_CRITICAL_SECTION();
 }
 
 /**
@@ -76,32 +120,27 @@ static _u32_t _semaphore_init_privilege_routine(arguments_t *pArgs)
 {
     ENTER_CRITICAL_SECTION();
 
-    _u8_t initialCount = (_u8_t)(pArgs[0].u8_val);
-    _u8_t limitCount = (_u8_t)(pArgs[1].u8_val);
+    _u32_t initialCount = (_u32_t)(pArgs[0].u32_val);
+    _u32_t limitCount = (_u32_t)(pArgs[1].u32_val);
     const _char_t *pName = (const _char_t *)(pArgs[2].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_SEMAPHORE_LIST, semaphore_context_t, pCurSemaphore)
-    {
-        if (_semaphore_context_isInvalid(pCurSemaphore)) {
-            break;
-        }
-
-        if (_semaphore_context_isInit(pCurSemaphore)) {
-            continue;
-        }
-
-        k_memset((_char_t *)pCurSemaphore, 0x0u, sizeof(semaphore_context_t));
-        pCurSemaphore->head.cs = CS_INITED;
-        pCurSemaphore->head.pName = pName;
-        pCurSemaphore->remains = initialCount;
-        pCurSemaphore->limits = limitCount;
-
+    semaphore_context_t *pCurSemaphore = (semaphore_context_t *)init_slot_alloc(INIT_SLOT_SEMAPHORE);
+    if (!pCurSemaphore) {
         EXIT_CRITICAL_SECTION();
-        return (_u32_t)pCurSemaphore;
+        return 0u;
     }
 
+    k_memset((_char_t *)pCurSemaphore, 0x0u, sizeof(semaphore_context_t));
+    pCurSemaphore->head.cs = CS_INITED;
+    pCurSemaphore->head.pName = pName;
+    pCurSemaphore->remains = initialCount;
+    pCurSemaphore->limits = limitCount;
+    pCurSemaphore->q_list.pRefreshFunc = semaphore_queue_refresh;
+
+    init_name_register(INIT_SLOT_SEMAPHORE, pCurSemaphore);
+
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (_u32_t)pCurSemaphore;
 }
 
 /**
@@ -116,14 +155,16 @@ static _i32p_t _semaphore_take_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     semaphore_context_t *pCurSemaphore = (semaphore_context_t *)pArgs[0].u32_val;
-    _u32_t timeout_ms = (_u32_t)pArgs[1].u32_val;
-    thread_context_t *pCurThread = NULL;
+    _u32_t *pCount = (_u32_t *)pArgs[1].pv_val;
+    _u32_t timeout_ms = (_u32_t)pArgs[2].u32_val;
+    struct schedule_task *pCurTask = NULL;
     _i32p_t postcode = 0;
 
-    pCurThread = kernel_thread_runContextGet();
-    if (!pCurSemaphore->remains) {
-        /* No availabe count */
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurSemaphore, NULL, &pCurSemaphore->q_list, timeout_ms, true);
+    pCurTask = kernel_task_runGet();
+    struct schedule_task *pHeadTask = (struct schedule_task *)list_head(&pCurSemaphore->q_list.list);
+    if ((pCurSemaphore->remains < *pCount) || ((pHeadTask) && (pHeadTask->prior <= pCurTask->prior))) {
+        /* No availabe count or the higher priority blocking thread is served first */
+        postcode = schedule_exit_trigger(pCurTask, pCurSemaphore, pCount, &pCurSemaphore->q_list, timeout_ms, true);
         PC_IF(postcode, PC_PASS)
         {
             postcode = PC_OS_WAIT_UNAVAILABLE;
@@ -134,7 +175,7 @@ static _i32p_t _semaphore_take_privilege_routine(arguments_t *pArgs)
     }
 
     /* The semaphore has available count */
-    pCurSemaphore->remains--;
+    pCurSemaphore->remains -= *pCount;
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -152,15 +193,16 @@ static _i32p_t _semaphore_give_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     semaphore_context_t *pCurSemaphore = (semaphore_context_t *)pArgs[0].u32_val;
+    _u32_t count = (_u32_t)pArgs[1].u32_val;
     _i32p_t postcode = 0;
 
-    if (pCurSemaphore->remains < pCurSemaphore->limits) {
-        pCurSemaphore->remains++;
+    if ((pCurSemaphore->limits - pCurSemaphore->remains) < count) {
+        count = pCurSemaphore->limits - pCurSemaphore->remains;
+    }
 
-        struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurSemaphore->q_list);
-        if (pCurTask) {
-            postcode = schedule_entry_trigger(pCurTask, _semaphore_schedule, 0u);
-        }
+    if (count) {
+        pCurSemaphore->remains += count;
+        postcode = _semaphore_ticket_handover(pCurSemaphore);
     }
 
     EXIT_CRITICAL_SECTION();
@@ -182,12 +224,11 @@ static _i32p_t _semaphore_flush_privilege_routine(arguments_t *pArgs)
     _i32p_t postcode = 0;
 
     list_iterator_t it = {0u};
-    list_t *pQList = (list_t *)&pCurSemaphore->q_list;
+    list_t *pQList = &pCurSemaphore->q_list.list;
     list_iterator_init(&it, pQList);
     struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
     while (pCurTask) {
-        pCurSemaphore->remains++;
-        postcode = schedule_entry_trigger(pCurTask, _semaphore_schedule, 0u);
+        postcode = _semaphore_wakeup(pCurTask, 0);
         if (PC_IER(postcode)) {
             break;
         }
@@ -198,6 +239,29 @@ static _i32p_t _semaphore_flush_privilege_routine(arguments_t *pArgs)
     return postcode;
 }
 
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static _i32p_t _semaphore_wait_order_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    semaphore_context_t *pCurSemaphore = (semaphore_context_t *)pArgs[0].u32_val;
+    _u8_t order = (_u8_t)pArgs[1].u8_val;
+    _i32p_t postcode = 0;
+
+    if (!schedule_wait_order_set(&pCurSemaphore->q_list, order)) {
+        postcode = PC_EOR;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -213,17 +277,19 @@ static _i32p_t _semaphore_delete_privilege_routine(arguments_t *pArgs)
     _i32p_t postcode = 0;
 
     list_iterator_t it = {0u};
-    list_t *plist = (list_t *)&pCurSemaphore->q_list;
+    list_t *plist = &pCurSemaphore->q_list.list;
     list_iterator_init(&it, plist);
     struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
     while (pCurTask) {
-        postcode = schedule_entry_trigger(pCurTask, _semaphore_schedule, _SEMAPHORE_DELETED);
+        postcode = _semaphore_wakeup(pCurTask, PC_OS_WAIT_NODATA);
         if (PC_IER(postcode)) {
             break;
         }
         pCurTask = (struct schedule_task *)list_iterator_next(&it);
     }
+    init_name_unregister(INIT_SLOT_SEMAPHORE, pCurSemaphore);
     k_memset((_char_t *)pCurSemaphore, 0x0u, sizeof(semaphore_context_t));
+    init_slot_free(INIT_SLOT_SEMAPHORE, pCurSemaphore);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -238,7 +304,7 @@ static _i32p_t _semaphore_delete_privilege_routine(arguments_t *pArgs)
  *
  * @return The semaphore unique id.
  */
-_u32_t _impl_semaphore_init(_u8_t remainCount, _u8_t limitCount, const _char_t *pName)
+_u32_t _impl_semaphore_init(_u32_t remainCount, _u32_t limitCount, const _char_t *pName)
 {
     if (!limitCount) {
         return OS_INVALID_ID_VAL;
@@ -249,8 +315,8 @@ _u32_t _impl_semaphore_init(_u8_t remainCount, _u8_t limitCount, const _char_t *
     }
 
     arguments_t arguments[] = {
-        [0] = {.u8_val = (_u8_t)remainCount},
-        [1] = {.u8_val = (_u8_t)limitCount},
+        [0] = {.u32_val = (_u32_t)remainCount},
+        [1] = {.u32_val = (_u32_t)limitCount},
         [2] = {.pch_val = (const _char_t *)pName},
     };
 
@@ -258,13 +324,29 @@ _u32_t _impl_semaphore_init(_u8_t remainCount, _u8_t limitCount, const _char_t *
 }
 
 /**
- * @brief Take the semaphore away with timeout option.
+ * @brief Find a semaphore id by its name.
+ *
+ * @param pName The semaphore name.
+ *
+ * @return The value of semaphore unique id.
+ */
+_u32_t _impl_semaphore_name_toId(const _char_t *pName)
+{
+    extern _u32_t _impl_kernel_name_toId(_u8_t type, const _char_t *pName);
+
+    return _impl_kernel_name_toId(INIT_SLOT_SEMAPHORE, pName);
+}
+
+/**
+ * @brief Take several semaphore counts away together with timeout option.
  *
  * @param ctx The semaphore unique id.
+ * @param count The number of the taking count.
+ * @param timeout_ms The blocking timeout value.
  *
  * @return The result of the operation.
  */
-_i32p_t _impl_semaphore_take(_u32_t ctx, _u32_t timeout_ms)
+_i32p_t _impl_semaphore_take_n(_u32_t ctx, _u32_t count, _u32_t timeout_ms)
 {
     semaphore_context_t *pCtx = (semaphore_context_t *)ctx;
     if (_semaphore_context_isInvalid(pCtx)) {
@@ -275,6 +357,10 @@ _i32p_t _impl_semaphore_take(_u32_t ctx, _u32_t timeout_ms)
         return PC_EOR;
     }
 
+    if ((!count) || (count > pCtx->limits)) {
+        return PC_EOR;
+    }
+
     if (!timeout_ms) {
         return PC_EOR;
     }
@@ -283,16 +369,25 @@ _i32p_t _impl_semaphore_take(_u32_t ctx, _u32_t timeout_ms)
         return PC_EOR;
     }
 
+    /* The stackless task returns before the wakeup, the count is kept in its own pend data */
+    _u32_t *pCount = &count;
+    struct stackless_task *pStackless = kernel_stackless_runGet();
+    if (pStackless) {
+        pStackless->pend.data.count = count;
+        pCount = &pStackless->pend.data.count;
+    }
+
     arguments_t arguments[] = {
         [0] = {.u32_val = (_u32_t)ctx},
-        [1] = {.u32_val = (_u32_t)timeout_ms},
+        [1] = {.pv_val = (void *)pCount},
+        [2] = {.u32_val = (_u32_t)timeout_ms},
     };
 
     _i32p_t postcode = kernel_privilege_invoke((const void *)_semaphore_take_privilege_routine, arguments);
 
     ENTER_CRITICAL_SECTION();
 
-    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+    if ((postcode == PC_OS_WAIT_UNAVAILABLE) && (!pStackless)) {
         postcode = kernel_schedule_result_take();
     }
 
@@ -301,13 +396,27 @@ _i32p_t _impl_semaphore_take(_u32_t ctx, _u32_t timeout_ms)
 }
 
 /**
- * @brief Give the semaphore to release the avaliable count.
+ * @brief Take the semaphore away with timeout option.
  *
- * @param id The semaphore unique id.
+ * @param ctx The semaphore unique id.
+ * @param timeout_ms The blocking timeout value.
  *
  * @return The result of the operation.
  */
-_i32p_t _impl_semaphore_give(_u32_t ctx)
+_i32p_t _impl_semaphore_take(_u32_t ctx, _u32_t timeout_ms)
+{
+    return _impl_semaphore_take_n(ctx, 1u, timeout_ms);
+}
+
+/**
+ * @brief Give several semaphore counts back together, the blocking threads are woken up in one pass.
+ *
+ * @param ctx The semaphore unique id.
+ * @param count The number of the giving count.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_semaphore_give_n(_u32_t ctx, _u32_t count)
 {
     semaphore_context_t *pCtx = (semaphore_context_t *)ctx;
     if (_semaphore_context_isInvalid(pCtx)) {
@@ -318,13 +427,30 @@ _i32p_t _impl_semaphore_give(_u32_t ctx)
         return PC_EOR;
     }
 
+    if (!count) {
+        return PC_EOR;
+    }
+
     arguments_t arguments[] = {
         [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u32_val = (_u32_t)count},
     };
 
     return kernel_privilege_invoke((const void *)_semaphore_give_privilege_routine, arguments);
 }
 
+/**
+ * @brief Give the semaphore to release the avaliable count.
+ *
+ * @param ctx The semaphore unique id.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_semaphore_give(_u32_t ctx)
+{
+    return _impl_semaphore_give_n(ctx, 1u);
+}
+
 /**
  * @brief Flush the semaphore to release all the avaliable count.
  *
@@ -350,6 +476,37 @@ _i32p_t _impl_semaphore_flush(_u32_t ctx)
     return kernel_privilege_invoke((const void *)_semaphore_flush_privilege_routine, arguments);
 }
 
+/**
+ * @brief Set the blocking threads waiting order of the semaphore, it's allowed when no thread is blocking.
+ *
+ * @param id The semaphore unique id.
+ * @param order The waiting order, the priority or the arrival order.
+ *
+ * @return The result of the operation.
+ */
+_i32p_t _impl_semaphore_wait_order_set(_u32_t ctx, _u8_t order)
+{
+    semaphore_context_t *pCtx = (semaphore_context_t *)ctx;
+    if (_semaphore_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_semaphore_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((order != WAIT_ORDER_PRIORITY_VAL) && (order != WAIT_ORDER_FIFO_VAL)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (_u32_t)ctx},
+        [1] = {.u8_val = (_u8_t)order},
+    };
+
+    return kernel_privilege_invoke((const void *)_semaphore_wait_order_set_privilege_routine, arguments);
+}
+
 /**
  * @brief Semaphore delete.
  *